@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include "AssetLoader.h"
+#include "Graphics.h"
+
+AssetLoader::AssetLoader()
+{
+	InFlight = 0;
+	Stopping = false;
+	Worker = std::thread(&AssetLoader::Run, this);
+}
+
+AssetLoader::~AssetLoader()
+{
+	{
+		std::lock_guard<std::mutex> guard(Lock);
+		Stopping = true;
+	}
+
+	Wake.notify_one();
+	Worker.join();
+
+	for (size_t i = 0; i < Queue.size(); i++)
+	{
+		Queue[i]->Promise.set_value(false);
+		delete Queue[i];
+	}
+	for (size_t i = 0; i < Completed.size(); i++)
+	{
+		Completed[i]->Promise.set_value(false);
+		delete Completed[i];
+	}
+}
+
+std::future<bool> AssetLoader::LoadCharset(Graphics& gfx, const char* filename, AssetCallback callback, void* userdata)
+{
+	Job* job = new Job();
+	job->Filename = filename;
+	job->Destination = gfx.Charset;
+	job->Size = sizeof(gfx.Charset);
+	job->Target = &gfx;
+	job->Callback = callback;
+	job->UserData = userdata;
+	return Enqueue(job);
+}
+
+std::future<bool> AssetLoader::LoadRaw(const char* filename, void* destination, size_t size, AssetCallback callback, void* userdata)
+{
+	Job* job = new Job();
+	job->Filename = filename;
+	job->Destination = destination;
+	job->Size = size;
+	job->Target = NULL;
+	job->Callback = callback;
+	job->UserData = userdata;
+	return Enqueue(job);
+}
+
+std::future<bool> AssetLoader::Enqueue(Job* job)
+{
+	job->Loaded = false;
+	std::future<bool> result = job->Promise.get_future();
+
+	{
+		std::lock_guard<std::mutex> guard(Lock);
+		Queue.push_back(job);
+		InFlight++;
+	}
+
+	Wake.notify_one();
+	return result;
+}
+
+void AssetLoader::Publish()
+{
+	std::vector<Job*> ready;
+
+	{
+		std::lock_guard<std::mutex> guard(Lock);
+		if (Completed.empty())
+			return;
+		ready.swap(Completed);
+		InFlight -= (int)ready.size();
+	}
+
+	for (size_t i = 0; i < ready.size(); i++)
+	{
+		Job* job = ready[i];
+
+		if (job->Loaded)
+		{
+			SDL_memcpy(job->Destination, job->Data.data(), job->Size);
+			if (job->Target)
+				job->Target->InvalidateGlyphCache();
+		}
+
+		if (job->Callback)
+			job->Callback(job->Loaded, job->UserData);
+
+		job->Promise.set_value(job->Loaded);
+		delete job;
+	}
+}
+
+int AssetLoader::Pending()
+{
+	std::lock_guard<std::mutex> guard(Lock);
+	return InFlight;
+}
+
+void AssetLoader::Run()
+{
+	while (true)
+	{
+		Job* job;
+
+		{
+			std::unique_lock<std::mutex> guard(Lock);
+			Wake.wait(guard, [this] { return Stopping || !Queue.empty(); });
+			if (Stopping)
+				return;
+			job = Queue.front();
+			Queue.pop_front();
+		}
+
+		job->Loaded = Read(*job);
+
+		std::lock_guard<std::mutex> guard(Lock);
+		Completed.push_back(job);
+	}
+}
+
+bool AssetLoader::Read(Job& job)
+{
+	FILE* fp = fopen(job.Filename.c_str(), "rb");
+	if (!fp)
+		return false;
+
+	// Reject files that would leave the destination partly overwritten
+	fseek(fp, 0, SEEK_END);
+	const long length = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	if (length < 0 || (size_t)length != job.Size)
+	{
+		fclose(fp);
+		return false;
+	}
+
+	job.Data.resize(job.Size);
+	const bool complete = fread(job.Data.data(), 1, job.Size, fp) == job.Size;
+	fclose(fp);
+
+	if (!complete)
+		job.Data.clear();
+
+	return complete;
+}
@@ -0,0 +1,59 @@
+#ifndef _ASSETLOADER_H_
+#define _ASSETLOADER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SDL.h>
+
+class Graphics;
+
+typedef void(*AssetCallback)(bool loaded, void* userdata);
+
+// Reads and validates asset files on a background thread. Finished loads
+// are held back until Publish(), which Graphics::Update() calls after the
+// frame is presented, so a frame never mixes old and new asset data.
+// Futures and callbacks complete on the publishing thread.
+class AssetLoader
+{
+public:
+	AssetLoader();
+	~AssetLoader();
+
+	std::future<bool> LoadCharset(Graphics& gfx, const char* filename, AssetCallback callback = NULL, void* userdata = NULL);
+	std::future<bool> LoadRaw(const char* filename, void* destination, size_t size, AssetCallback callback = NULL, void* userdata = NULL);
+	void Publish();
+	int Pending();
+
+private:
+	struct Job
+	{
+		std::string Filename;
+		void* Destination;
+		size_t Size;
+		Graphics* Target;
+		AssetCallback Callback;
+		void* UserData;
+		std::vector<Uint8> Data;
+		bool Loaded;
+		std::promise<bool> Promise;
+	};
+
+	std::thread Worker;
+	std::mutex Lock;
+	std::condition_variable Wake;
+	std::deque<Job*> Queue;
+	std::vector<Job*> Completed;
+	int InFlight;
+	bool Stopping;
+
+	std::future<bool> Enqueue(Job* job);
+	void Run();
+	static bool Read(Job& job);
+};
+
+#endif
@@ -0,0 +1,153 @@
+#include "Blend.h"
+#include "Simd.h"
+
+#define ALPHA_MASK 0xff000000
+#define COLOR_MASK 0x00ffffff
+
+static inline Uint32 Div255(Uint32 value)
+{
+	value += 128;
+	return (value + (value >> 8)) >> 8;
+}
+
+static inline Uint32 BlendAlpha(Uint32 dst, Uint32 src)
+{
+	const Uint32 a = src >> 24;
+	const Uint32 ia = 255 - a;
+	Uint32 result = 0;
+
+	for (int shift = 0; shift < 32; shift += 8)
+		result |= Div255(((src >> shift) & 0xff) * a + ((dst >> shift) & 0xff) * ia) << shift;
+
+	return result;
+}
+
+static inline Uint32 BlendPremultiplied(Uint32 dst, Uint32 src)
+{
+	const Uint32 ia = 255 - (src >> 24);
+	Uint32 result = 0;
+
+	for (int shift = 0; shift < 32; shift += 8)
+	{
+		Uint32 channel = ((src >> shift) & 0xff) + Div255(((dst >> shift) & 0xff) * ia);
+		if (channel > 255)
+			channel = 255;
+		result |= channel << shift;
+	}
+
+	return result;
+}
+
+#ifdef HAVE_SSE2
+static inline __m128i Div255x8(__m128i value)
+{
+	value = _mm_add_epi16(value, _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+}
+
+static inline __m128i SpreadAlpha(__m128i pixels16)
+{
+	pixels16 = _mm_shufflelo_epi16(pixels16, _MM_SHUFFLE(3, 3, 3, 3));
+	return _mm_shufflehi_epi16(pixels16, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+static inline __m128i BlendAlphaHalf(__m128i dst16, __m128i src16)
+{
+	const __m128i a = SpreadAlpha(src16);
+	const __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+	return Div255x8(_mm_add_epi16(_mm_mullo_epi16(src16, a), _mm_mullo_epi16(dst16, ia)));
+}
+
+static inline __m128i BlendPremultipliedHalf(__m128i dst16, __m128i src16)
+{
+	const __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), SpreadAlpha(src16));
+	return Div255x8(_mm_mullo_epi16(dst16, ia));
+}
+
+static inline __m128i Blend4(__m128i dst, __m128i src, BlendMode mode)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i dstLo = _mm_unpacklo_epi8(dst, zero);
+	const __m128i dstHi = _mm_unpackhi_epi8(dst, zero);
+	const __m128i srcLo = _mm_unpacklo_epi8(src, zero);
+	const __m128i srcHi = _mm_unpackhi_epi8(src, zero);
+
+	if (mode == BLEND_ALPHA)
+		return _mm_packus_epi16(BlendAlphaHalf(dstLo, srcLo), BlendAlphaHalf(dstHi, srcHi));
+
+	const __m128i scaled = _mm_packus_epi16(BlendPremultipliedHalf(dstLo, srcLo), BlendPremultipliedHalf(dstHi, srcHi));
+	return _mm_adds_epu8(src, scaled);
+}
+#endif
+
+void BlendRow(Uint32* dst, const Uint32* src, int count, BlendMode mode, Uint32 colorkey)
+{
+	int i = 0;
+
+#ifdef HAVE_SSE2
+	if (mode == BLEND_COLORKEY)
+	{
+		const __m128i key = _mm_set1_epi32(colorkey & COLOR_MASK);
+		const __m128i colorMask = _mm_set1_epi32(COLOR_MASK);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+			const __m128i keep = _mm_cmpeq_epi32(_mm_and_si128(s, colorMask), key);
+			const int bits = _mm_movemask_epi8(keep);
+
+			if (bits == 0xffff)
+				continue;
+
+			__m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+			d = _mm_or_si128(_mm_and_si128(keep, d), _mm_andnot_si128(keep, _mm_and_si128(s, colorMask)));
+			_mm_storeu_si128((__m128i*)(dst + i), d);
+		}
+	}
+	else
+	{
+		const __m128i alphaMask = _mm_set1_epi32(ALPHA_MASK);
+		const __m128i colorMask = _mm_set1_epi32(COLOR_MASK);
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i emptyMask = mode == BLEND_ALPHA ? alphaMask : _mm_set1_epi32(-1);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+			const __m128i alpha = _mm_and_si128(s, alphaMask);
+
+			// Fully transparent and fully opaque groups skip the arithmetic;
+			// premultiplied pixels with zero alpha still add their colour
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s, emptyMask), zero)) == 0xffff)
+				continue;
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xffff)
+			{
+				_mm_storeu_si128((__m128i*)(dst + i), _mm_and_si128(s, colorMask));
+				continue;
+			}
+
+			const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_and_si128(Blend4(d, s, mode), colorMask));
+		}
+	}
+#endif
+
+	for (; i < count; i++)
+	{
+		const Uint32 s = src[i];
+
+		if (mode == BLEND_COLORKEY)
+		{
+			if ((s & COLOR_MASK) != (colorkey & COLOR_MASK))
+				dst[i] = s & COLOR_MASK;
+		}
+		else if ((s & ALPHA_MASK) == ALPHA_MASK)
+		{
+			dst[i] = s & COLOR_MASK;
+		}
+		else if (mode == BLEND_ALPHA ? (s & ALPHA_MASK) != 0 : s != 0)
+		{
+			dst[i] = (mode == BLEND_ALPHA ? BlendAlpha(dst[i], s) : BlendPremultiplied(dst[i], s)) & COLOR_MASK;
+		}
+	}
+}
@@ -0,0 +1,17 @@
+#ifndef _BLEND_H_
+#define _BLEND_H_
+
+#include <SDL.h>
+
+enum BlendMode
+{
+	BLEND_COLORKEY = 0,
+	BLEND_ALPHA = 1,
+	BLEND_PREMULTIPLIED = 2
+};
+
+// Composites src over dst. Results are stored as 0x00RRGGBB like every
+// other writer of the screen Buffer; source alpha only weights the blend.
+void BlendRow(Uint32* dst, const Uint32* src, int count, BlendMode mode, Uint32 colorkey);
+
+#endif
@@ -0,0 +1,200 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include "Canvas.h"
+
+#define FMT_TO_STR_MAXLEN 1024
+
+Canvas::Canvas(Graphics& gfx, int width, int height) : Owner(gfx)
+{
+	W = SDL_max(width, 1);
+	H = SDL_max(height, 1);
+	Data = new int[(size_t)W * H];
+	Version = 0;
+	Clear(0);
+}
+
+Canvas::~Canvas()
+{
+	delete[] Data;
+}
+
+int Canvas::Width() const
+{
+	return W;
+}
+
+int Canvas::Height() const
+{
+	return H;
+}
+
+const int* Canvas::Pixels() const
+{
+	return Data;
+}
+
+int* Canvas::Row(int y)
+{
+	Version++;
+	return &Data[(size_t)y * W];
+}
+
+Uint32 Canvas::Revision() const
+{
+	return Version;
+}
+
+void Canvas::Clear(int color)
+{
+	SDL_memset4(Data, color, (size_t)W * H);
+	Version++;
+}
+
+void Canvas::SetPixel(int x, int y, int color)
+{
+	if ((unsigned)x < (unsigned)W && (unsigned)y < (unsigned)H)
+	{
+		Data[(size_t)y * W + x] = color;
+		Version++;
+	}
+}
+
+int Canvas::GetPixel(int x, int y) const
+{
+	return (unsigned)x < (unsigned)W && (unsigned)y < (unsigned)H ? Data[(size_t)y * W + x] : 0;
+}
+
+// Points the owner's rasterizers at this canvas for one draw call
+void Canvas::Bind()
+{
+	Surface surface;
+	surface.Pixels = Data;
+	surface.Pitch = W;
+	surface.Clip.x = 0;
+	surface.Clip.y = 0;
+	surface.Clip.w = W;
+	surface.Clip.h = H;
+	Owner.SetTarget(&surface);
+}
+
+void Canvas::Unbind()
+{
+	Owner.SetTarget(NULL);
+	Version++;
+}
+
+void Canvas::DrawLine(int x1, int y1, int x2, int y2, int color)
+{
+	Bind();
+	Owner.DrawLine(x1, y1, x2, y2, color);
+	Unbind();
+}
+
+void Canvas::DrawRect(int x, int y, int w, int h, int color)
+{
+	Bind();
+	Owner.DrawRect(x, y, w, h, color);
+	Unbind();
+}
+
+void Canvas::FillRect(int x, int y, int w, int h, int color)
+{
+	Bind();
+	Owner.FillRect(x, y, w, h, color);
+	Unbind();
+}
+
+void Canvas::DrawCircle(int cx, int cy, int radius, int color)
+{
+	Bind();
+	Owner.DrawCircle(cx, cy, radius, color);
+	Unbind();
+}
+
+void Canvas::FillCircle(int cx, int cy, int radius, int color)
+{
+	Bind();
+	Owner.FillCircle(cx, cy, radius, color);
+	Unbind();
+}
+
+void Canvas::DrawEllipse(int cx, int cy, int rx, int ry, int color)
+{
+	Bind();
+	Owner.DrawEllipse(cx, cy, rx, ry, color);
+	Unbind();
+}
+
+void Canvas::FillEllipse(int cx, int cy, int rx, int ry, int color)
+{
+	Bind();
+	Owner.FillEllipse(cx, cy, rx, ry, color);
+	Unbind();
+}
+
+void Canvas::DrawPolygon(const SDL_Point* points, int count, int color)
+{
+	Bind();
+	Owner.DrawPolygon(points, count, color);
+	Unbind();
+}
+
+void Canvas::FillPolygon(const SDL_Point* points, int count, int color)
+{
+	Bind();
+	Owner.FillPolygon(points, count, color);
+	Unbind();
+}
+
+void Canvas::BlitImage(const Uint32* pixels, int w, int h, int pitch, int x, int y, BlendMode mode, Uint32 colorkey)
+{
+	Bind();
+	Owner.BlitImage(pixels, w, h, pitch, x, y, mode, colorkey);
+	Unbind();
+}
+
+void Canvas::DrawChar(int chr, int x, int y, int forecolor, int backcolor, int transform)
+{
+	Bind();
+	Owner.DrawChar((unsigned int)chr % CHARSET_SIZE, x, y, forecolor, backcolor, transform);
+	Unbind();
+}
+
+void Canvas::PutChar(int chr, int x, int y, int forecolor, int backcolor, int transform)
+{
+	DrawChar(chr, x * CHAR_W, y * CHAR_H, forecolor, backcolor, transform);
+}
+
+void Canvas::PutCell(Cell cell, int x, int y)
+{
+	Bind();
+	Owner.PutCell(cell, x, y);
+	Unbind();
+}
+
+void Canvas::Print(int x, int y, int forecolor, int backcolor, const char* fmt, ...)
+{
+	char str[FMT_TO_STR_MAXLEN] = { 0 };
+	va_list arg;
+	va_start(arg, fmt);
+	vsprintf_s(str, fmt, arg);
+	va_end(arg);
+
+	for (int i = 0; str[i]; i++)
+		PutChar((byte)str[i], x++, y, forecolor, backcolor);
+}
+
+void Canvas::PrintUtf8(int x, int y, int forecolor, int backcolor, const char* fmt, ...)
+{
+	char str[FMT_TO_STR_MAXLEN] = { 0 };
+	va_list arg;
+	va_start(arg, fmt);
+	vsprintf_s(str, fmt, arg);
+	va_end(arg);
+
+	Uint16 glyphs[FMT_TO_STR_MAXLEN];
+	const int count = Owner.Codepoints.Decode(str, SDL_strlen(str), glyphs, FMT_TO_STR_MAXLEN);
+
+	for (int i = 0; i < count; i++)
+		PutChar(glyphs[i], x++, y, forecolor, backcolor);
+}
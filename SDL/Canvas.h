@@ -0,0 +1,58 @@
+#ifndef _CANVAS_H_
+#define _CANVAS_H_
+
+#include "Graphics.h"
+
+// Offscreen drawing surface of any size in the same pixel format as the
+// screen Buffer. Drawing goes through the rasterizers of the Graphics it
+// was created for, so glyphs, palette, codepoint map and draw mode are
+// shared with it; the screen's monochrome mode does not apply. Contents
+// persist until redrawn, so a panel can be drawn once and composited
+// every frame with Graphics::DrawCanvas(). Revision() changes on every
+// draw call for callers that cache further.
+class Canvas
+{
+public:
+	Canvas(Graphics& gfx, int width, int height);
+	~Canvas();
+
+	int Width() const;
+	int Height() const;
+	const int* Pixels() const;
+	int* Row(int y);
+	Uint32 Revision() const;
+
+	void Clear(int color);
+	void SetPixel(int x, int y, int color);
+	int GetPixel(int x, int y) const;
+	void DrawLine(int x1, int y1, int x2, int y2, int color);
+	void DrawRect(int x, int y, int w, int h, int color);
+	void FillRect(int x, int y, int w, int h, int color);
+	void DrawCircle(int cx, int cy, int radius, int color);
+	void FillCircle(int cx, int cy, int radius, int color);
+	void DrawEllipse(int cx, int cy, int rx, int ry, int color);
+	void FillEllipse(int cx, int cy, int rx, int ry, int color);
+	void DrawPolygon(const SDL_Point* points, int count, int color);
+	void FillPolygon(const SDL_Point* points, int count, int color);
+	void BlitImage(const Uint32* pixels, int w, int h, int pitch, int x, int y, BlendMode mode, Uint32 colorkey = 0);
+	void DrawChar(int chr, int x, int y, int forecolor, int backcolor, int transform = GLYPH_NORMAL);
+	void PutChar(int chr, int x, int y, int forecolor, int backcolor, int transform = GLYPH_NORMAL);
+	void PutCell(Cell cell, int x, int y);
+	void Print(int x, int y, int forecolor, int backcolor, const char* fmt, ...);
+	void PrintUtf8(int x, int y, int forecolor, int backcolor, const char* fmt, ...);
+
+private:
+	Graphics& Owner;
+	int W;
+	int H;
+	int* Data;
+	Uint32 Version;
+
+	void Bind();
+	void Unbind();
+
+	Canvas(const Canvas&) = delete;
+	Canvas& operator=(const Canvas&) = delete;
+};
+
+#endif
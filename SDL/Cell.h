@@ -0,0 +1,50 @@
+#ifndef _CELL_H_
+#define _CELL_H_
+
+#include <SDL.h>
+
+// A character cell packed into 32 bits:
+//   bits  0-8   glyph index (0-511)
+//   bits  9-15  attributes
+//   bits 16-23  foreground palette index
+//   bits 24-31  background palette index
+typedef Uint32 Cell;
+
+#define CELL_GLYPH_MASK 0x1ff
+#define CELL_ATTR_SHIFT 9
+#define CELL_ATTR_MASK 0x7f
+#define CELL_FG_SHIFT 16
+#define CELL_BG_SHIFT 24
+
+#define CELL_ATTR_TRANSFORM 0x07
+#define CELL_ATTR_REVERSE 0x08
+
+inline Cell MakeCell(int glyph, int forecolor, int backcolor, int attributes = 0)
+{
+	return (Cell)(glyph & CELL_GLYPH_MASK) |
+		((Cell)(attributes & CELL_ATTR_MASK) << CELL_ATTR_SHIFT) |
+		((Cell)(forecolor & 0xff) << CELL_FG_SHIFT) |
+		((Cell)(backcolor & 0xff) << CELL_BG_SHIFT);
+}
+
+inline int CellGlyph(Cell cell)
+{
+	return cell & CELL_GLYPH_MASK;
+}
+
+inline int CellAttributes(Cell cell)
+{
+	return (cell >> CELL_ATTR_SHIFT) & CELL_ATTR_MASK;
+}
+
+inline int CellForeground(Cell cell)
+{
+	return (cell >> CELL_FG_SHIFT) & 0xff;
+}
+
+inline int CellBackground(Cell cell)
+{
+	return cell >> CELL_BG_SHIFT;
+}
+
+#endif
@@ -0,0 +1,72 @@
+#include "CellGrid.h"
+#include "Simd.h"
+
+CellGrid::CellGrid()
+{
+	Fill(0);
+}
+
+void CellGrid::Fill(Cell cell)
+{
+	SDL_memset4(Cells, cell, COLS * ROWS);
+}
+
+void CellGrid::FillRect(int col, int row, int w, int h, Cell cell)
+{
+	const int col1 = SDL_max(col, 0);
+	const int row1 = SDL_max(row, 0);
+	const int col2 = SDL_min(col + w, COLS);
+	const int row2 = SDL_min(row + h, ROWS);
+
+	if (col1 >= col2)
+		return;
+
+	for (int y = row1; y < row2; y++)
+		SDL_memset4(&Cells[y][col1], cell, col2 - col1);
+}
+
+void CellGrid::CopyFrom(const CellGrid& other)
+{
+	SDL_memcpy(Cells, other.Cells, sizeof(Cells));
+}
+
+bool CellGrid::Equals(const CellGrid& other) const
+{
+	return SDL_memcmp(Cells, other.Cells, sizeof(Cells)) == 0;
+}
+
+int CellGrid::Diff(const CellGrid& other, Uint32* rowMasks) const
+{
+	int changed = 0;
+
+	for (int row = 0; row < ROWS; row++)
+	{
+		const Cell* a = Cells[row];
+		const Cell* b = other.Cells[row];
+		Uint32 mask = 0;
+
+#ifdef HAVE_SSE2
+		for (int col = 0; col < COLS; col += 4)
+		{
+			const __m128i equal = _mm_cmpeq_epi32(_mm_load_si128((const __m128i*)(a + col)), _mm_load_si128((const __m128i*)(b + col)));
+			mask |= (Uint32)(~_mm_movemask_ps(_mm_castsi128_ps(equal)) & 0xf) << col;
+		}
+#else
+		for (int col = 0; col < COLS; col++)
+			if (a[col] != b[col])
+				mask |= 1u << col;
+#endif
+
+		rowMasks[row] = mask;
+		if (mask)
+			changed++;
+	}
+
+	return changed;
+}
+
+void CellGrid::Print(int col, int row, int forecolor, int backcolor, const char* str)
+{
+	for (; *str; str++, col++)
+		Set(col, row, MakeCell((unsigned char)*str, forecolor, backcolor));
+}
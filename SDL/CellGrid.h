@@ -0,0 +1,36 @@
+#ifndef _CELLGRID_H_
+#define _CELLGRID_H_
+
+#include "Graphics.h"
+
+// A full screen of packed cells. Rows are 128 bytes and the grid is
+// cache-line aligned, so fills, copies and compares run on whole lines.
+static_assert(COLS <= 32, "CellGrid::Diff packs one row into a 32-bit mask");
+
+class CellGrid
+{
+public:
+	alignas(64) Cell Cells[ROWS][COLS];
+
+	CellGrid();
+
+	void Fill(Cell cell);
+	void FillRect(int col, int row, int w, int h, Cell cell);
+	void CopyFrom(const CellGrid& other);
+	bool Equals(const CellGrid& other) const;
+	int Diff(const CellGrid& other, Uint32* rowMasks) const;
+	void Print(int col, int row, int forecolor, int backcolor, const char* str);
+
+	inline void Set(int col, int row, Cell cell)
+	{
+		if (col >= 0 && row >= 0 && col < COLS && row < ROWS)
+			Cells[row][col] = cell;
+	}
+
+	inline Cell Get(int col, int row) const
+	{
+		return Cells[row][col];
+	}
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include <algorithm>
+#include "Collision.h"
+
+static const Uint64 ByteColumns = 0x0101010101010101ULL;
+
+CollisionWorld::CollisionWorld()
+{
+	SDL_memset(CellStart, 0, sizeof(CellStart));
+}
+
+void CollisionWorld::Clear()
+{
+	Objects.clear();
+}
+
+int CollisionWorld::Add(const byte* glyph, int x, int y)
+{
+	Object object;
+	object.X = x;
+	object.Y = y;
+	object.Mask = GlyphMask(glyph);
+	Objects.push_back(object);
+	return (int)Objects.size() - 1;
+}
+
+int CollisionWorld::Add(Graphics& gfx, int chr, int x, int y)
+{
+	return Add(gfx.Charset[chr], x, y);
+}
+
+void CollisionWorld::Move(int id, int x, int y)
+{
+	Objects[id].X = x;
+	Objects[id].Y = y;
+}
+
+int CollisionWorld::Count()
+{
+	return (int)Objects.size();
+}
+
+Uint64 CollisionWorld::GlyphMask(const byte* glyph)
+{
+	// Row 0 goes in the top byte so moving down is a right shift by 8
+	Uint64 mask = 0;
+	for (int i = 0; i < CHAR_H; i++)
+		mask = (mask << 8) | glyph[i];
+	return mask;
+}
+
+bool CollisionWorld::MasksOverlap(Uint64 a, int ax, int ay, Uint64 b, int bx, int by)
+{
+	int dx = bx - ax;
+	int dy = by - ay;
+
+	if (dx <= -CHAR_W || dx >= CHAR_W || dy <= -CHAR_H || dy >= CHAR_H)
+		return false;
+
+	// Always shift the object that is further right and further down
+	if (dy < 0)
+	{
+		std::swap(a, b);
+		dx = -dx;
+		dy = -dy;
+	}
+
+	b >>= dy * 8;
+
+	// Bits moving out of a row byte must not leak into the next row
+	if (dx > 0)
+		b = (b >> dx) & ((0xff >> dx) * ByteColumns);
+	else if (dx < 0)
+		b = (b << -dx) & ((byte)(0xff << -dx) * ByteColumns);
+
+	return (a & b) != 0;
+}
+
+bool CollisionWorld::Overlaps(int a, int b)
+{
+	const Object& first = Objects[a];
+	const Object& second = Objects[b];
+	return MasksOverlap(first.Mask, first.X, first.Y, second.Mask, second.X, second.Y);
+}
+
+void CollisionWorld::CellRange(const Object& object, int& col1, int& row1, int& col2, int& row2)
+{
+	// Objects partly or fully off screen are folded into the border cells
+	col1 = SDL_max(0, SDL_min(COLLISION_COLS - 1, object.X / COLLISION_CELL_W - (object.X < 0)));
+	row1 = SDL_max(0, SDL_min(COLLISION_ROWS - 1, object.Y / COLLISION_CELL_H - (object.Y < 0)));
+	col2 = SDL_max(0, SDL_min(COLLISION_COLS - 1, (object.X + CHAR_W - 1) / COLLISION_CELL_W));
+	row2 = SDL_max(0, SDL_min(COLLISION_ROWS - 1, (object.Y + CHAR_H - 1) / COLLISION_CELL_H));
+}
+
+void CollisionWorld::BuildGrid()
+{
+	const int cells = COLLISION_ROWS * COLLISION_COLS;
+	SDL_memset(CellStart, 0, sizeof(CellStart));
+
+	int col1, row1, col2, row2;
+	int total = 0;
+
+	for (size_t i = 0; i < Objects.size(); i++)
+	{
+		CellRange(Objects[i], col1, row1, col2, row2);
+		for (int row = row1; row <= row2; row++)
+			for (int col = col1; col <= col2; col++)
+				CellStart[row * COLLISION_COLS + col + 1]++;
+		total += (row2 - row1 + 1) * (col2 - col1 + 1);
+	}
+
+	for (int i = 0; i < cells; i++)
+		CellStart[i + 1] += CellStart[i];
+
+	Entries.resize(total);
+	SDL_memcpy(CellFill, CellStart, sizeof(CellFill));
+
+	for (size_t i = 0; i < Objects.size(); i++)
+	{
+		CellRange(Objects[i], col1, row1, col2, row2);
+		for (int row = row1; row <= row2; row++)
+			for (int col = col1; col <= col2; col++)
+				Entries[CellFill[row * COLLISION_COLS + col]++] = (int)i;
+	}
+}
+
+int CollisionWorld::FindPairs(std::vector<CollisionPair>& pairs)
+{
+	TRACE_SCOPE("CollisionWorld::FindPairs");
+	pairs.clear();
+	BuildGrid();
+
+	for (int row = 0; row < COLLISION_ROWS; row++)
+	{
+		for (int col = 0; col < COLLISION_COLS; col++)
+		{
+			const int cell = row * COLLISION_COLS + col;
+			const int end = CellStart[cell + 1];
+
+			for (int i = CellStart[cell]; i < end; i++)
+			{
+				const Object& a = Objects[Entries[i]];
+				int acol1, arow1, acol2, arow2;
+				CellRange(a, acol1, arow1, acol2, arow2);
+
+				for (int j = i + 1; j < end; j++)
+				{
+					const Object& b = Objects[Entries[j]];
+					if (!MasksOverlap(a.Mask, a.X, a.Y, b.Mask, b.X, b.Y))
+						continue;
+
+					// A pair sharing several cells is reported only from the
+					// first cell the two ranges have in common
+					int bcol1, brow1, bcol2, brow2;
+					CellRange(b, bcol1, brow1, bcol2, brow2);
+					if (SDL_max(acol1, bcol1) != col || SDL_max(arow1, brow1) != row)
+						continue;
+
+					CollisionPair pair;
+					pair.A = SDL_min(Entries[i], Entries[j]);
+					pair.B = SDL_max(Entries[i], Entries[j]);
+					pairs.push_back(pair);
+				}
+			}
+		}
+	}
+
+	return (int)pairs.size();
+}
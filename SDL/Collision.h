@@ -0,0 +1,56 @@
+#ifndef _COLLISION_H_
+#define _COLLISION_H_
+
+#include <vector>
+#include "Graphics.h"
+
+#define COLLISION_CELL_W CHAR_W
+#define COLLISION_CELL_H CHAR_H
+#define COLLISION_COLS (SCREEN_W / COLLISION_CELL_W)
+#define COLLISION_ROWS (SCREEN_H / COLLISION_CELL_H)
+
+struct CollisionPair
+{
+	int A;
+	int B;
+};
+
+// Pixel-exact collision between glyph-shaped objects. Each object keeps
+// its 8x8 glyph as a 64-bit mask, one byte per row, so an overlap test is
+// a couple of shifts and an AND. Candidate pairs come from a uniform grid
+// over the screen that is rebuilt with a counting sort on every query.
+class CollisionWorld
+{
+public:
+	CollisionWorld();
+
+	void Clear();
+	int Add(const byte* glyph, int x, int y);
+	int Add(Graphics& gfx, int chr, int x, int y);
+	void Move(int id, int x, int y);
+	int Count();
+
+	bool Overlaps(int a, int b);
+	int FindPairs(std::vector<CollisionPair>& pairs);
+
+	static Uint64 GlyphMask(const byte* glyph);
+	static bool MasksOverlap(Uint64 a, int ax, int ay, Uint64 b, int bx, int by);
+
+private:
+	struct Object
+	{
+		int X;
+		int Y;
+		Uint64 Mask;
+	};
+
+	std::vector<Object> Objects;
+	std::vector<int> Entries;
+	int CellStart[COLLISION_ROWS * COLLISION_COLS + 1];
+	int CellFill[COLLISION_ROWS * COLLISION_COLS];
+
+	void CellRange(const Object& object, int& col1, int& row1, int& col2, int& row2);
+	void BuildGrid();
+};
+
+#endif
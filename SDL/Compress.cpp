@@ -0,0 +1,169 @@
+#include "Compress.h"
+
+#define HASH_BITS 14
+#define MIN_MATCH 4
+#define MAX_OFFSET 65535
+#define LAST_LITERALS 5
+
+static inline Uint32 Read32(const Uint8* p)
+{
+	Uint32 value;
+	SDL_memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static inline Uint32 HashSequence(Uint32 sequence)
+{
+	return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static void WriteLength(std::vector<Uint8>& output, size_t length)
+{
+	while (length >= 255)
+	{
+		output.push_back(255);
+		length -= 255;
+	}
+	output.push_back((Uint8)length);
+}
+
+static void WriteSequence(std::vector<Uint8>& output, const Uint8* literals, size_t literalCount, size_t offset, size_t matchLength)
+{
+	const size_t matchCode = matchLength ? matchLength - MIN_MATCH : 0;
+	output.push_back((Uint8)((SDL_min(literalCount, (size_t)15) << 4) | SDL_min(matchCode, (size_t)15)));
+
+	if (literalCount >= 15)
+		WriteLength(output, literalCount - 15);
+
+	output.insert(output.end(), literals, literals + literalCount);
+
+	if (matchLength)
+	{
+		output.push_back((Uint8)offset);
+		output.push_back((Uint8)(offset >> 8));
+		if (matchCode >= 15)
+			WriteLength(output, matchCode - 15);
+	}
+}
+
+void CompressBlock(const void* data, size_t size, std::vector<Uint8>& output)
+{
+	const Uint8* src = (const Uint8*)data;
+	const Uint8* end = src + size;
+	const Uint8* anchor = src;
+	const Uint8* p = src;
+
+	output.clear();
+	output.reserve(size / 2 + 16);
+
+	if (size > MIN_MATCH + LAST_LITERALS)
+	{
+		static thread_local Uint32 table[1 << HASH_BITS];
+		SDL_memset(table, 0, sizeof(table));
+
+		const Uint8* matchLimit = end - LAST_LITERALS;
+		p++;
+
+		while (p + MIN_MATCH <= matchLimit)
+		{
+			const Uint32 sequence = Read32(p);
+			const Uint32 hash = HashSequence(sequence);
+			const Uint8* candidate = src + table[hash];
+			table[hash] = (Uint32)(p - src);
+
+			// Step faster through data that keeps failing to match
+			if (candidate >= p || p - candidate > MAX_OFFSET || Read32(candidate) != sequence)
+			{
+				p += 1 + ((p - anchor) >> 6);
+				continue;
+			}
+
+			const Uint8* match = p + MIN_MATCH;
+			const Uint8* from = candidate + MIN_MATCH;
+			while (match + sizeof(Uint32) <= matchLimit && Read32(match) == Read32(from))
+			{
+				match += sizeof(Uint32);
+				from += sizeof(Uint32);
+			}
+			while (match < matchLimit && *match == *from)
+			{
+				match++;
+				from++;
+			}
+
+			WriteSequence(output, anchor, p - anchor, p - candidate, match - p);
+			p = anchor = match;
+		}
+	}
+
+	// The block always ends with a literal-only sequence
+	WriteSequence(output, anchor, end - anchor, 0, 0);
+}
+
+static bool ReadLength(const Uint8*& p, const Uint8* end, size_t& length)
+{
+	Uint8 value;
+	do
+	{
+		if (p >= end)
+			return false;
+		value = *p++;
+		length += value;
+	} while (value == 255);
+
+	return true;
+}
+
+bool DecompressBlock(const void* data, size_t size, void* output, size_t outputSize)
+{
+	const Uint8* p = (const Uint8*)data;
+	const Uint8* end = p + size;
+	Uint8* dst = (Uint8*)output;
+	Uint8* const dstStart = dst;
+	Uint8* const dstEnd = dst + outputSize;
+
+	while (p < end)
+	{
+		const Uint8 token = *p++;
+
+		size_t literals = token >> 4;
+		if (literals == 15 && !ReadLength(p, end, literals))
+			return false;
+		if (literals > (size_t)(end - p) || literals > (size_t)(dstEnd - dst))
+			return false;
+
+		SDL_memcpy(dst, p, literals);
+		dst += literals;
+		p += literals;
+
+		if (p == end)
+			break;
+
+		if (end - p < 2)
+			return false;
+		const size_t offset = p[0] | (p[1] << 8);
+		p += 2;
+
+		size_t length = token & 15;
+		if (length == 15 && !ReadLength(p, end, length))
+			return false;
+		length += MIN_MATCH;
+
+		if (offset == 0 || offset > (size_t)(dst - dstStart) || length > (size_t)(dstEnd - dst))
+			return false;
+
+		// A match may overlap its own output. Everything from the match start
+		// onwards repeats with period offset, so each copy can take all bytes
+		// written so far and the chunk size doubles.
+		const Uint8* from = dst - offset;
+		while (length)
+		{
+			const size_t chunk = SDL_min(length, (size_t)(dst - from));
+			SDL_memcpy(dst, from, chunk);
+			dst += chunk;
+			length -= chunk;
+		}
+	}
+
+	return dst == dstEnd;
+}
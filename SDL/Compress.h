@@ -0,0 +1,15 @@
+#ifndef _COMPRESS_H_
+#define _COMPRESS_H_
+
+#include <stddef.h>
+#include <vector>
+#include <SDL.h>
+
+// Byte-oriented LZ77 in the style of the LZ4 block format: each sequence
+// is a token with literal and match length nibbles, the literals, and a
+// 16-bit match offset. Fast rather than small; the decoder is bounds
+// checked and rejects malformed input.
+void CompressBlock(const void* data, size_t size, std::vector<Uint8>& output);
+bool DecompressBlock(const void* data, size_t size, void* output, size_t outputSize);
+
+#endif
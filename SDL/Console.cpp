@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include "Console.h"
+
+#define FMT_TO_STR_MAXLEN 1024
+
+static_assert(ROWS <= 32, "Console tracks dirty rows in a 32-bit mask");
+
+Console::Console(int capacity)
+{
+	Capacity = SDL_max(capacity, 1);
+	Lines = new Cell[(size_t)Capacity * COLS];
+	Foreground = CONSOLE_DEFAULT_FG;
+	Background = CONSOLE_DEFAULT_BG;
+	Clear();
+}
+
+Console::~Console()
+{
+	delete[] Lines;
+}
+
+void Console::Clear()
+{
+	First = 0;
+	End = 1;
+	Column = 0;
+	Top = 0;
+	Following = true;
+	DirtyRows = 0;
+	SDL_memset4(LineCells(0), MakeCell(' ', Foreground, Background), COLS);
+	Invalidate();
+}
+
+void Console::Invalidate()
+{
+	RenderedValid = false;
+}
+
+void Console::SetColor(int forecolor, int backcolor)
+{
+	Foreground = forecolor;
+	Background = backcolor;
+}
+
+Cell* Console::LineCells(Uint64 line)
+{
+	return &Lines[(size_t)(line % Capacity) * COLS];
+}
+
+const Cell* Console::GetLine(Uint64 line)
+{
+	return line >= First && line < End ? LineCells(line) : NULL;
+}
+
+Uint64 Console::FirstLine()
+{
+	return First;
+}
+
+Uint64 Console::LineCount()
+{
+	return End - First;
+}
+
+Uint64 Console::TopLine()
+{
+	ClampTop();
+	return Top;
+}
+
+void Console::MarkDirty(Uint64 line)
+{
+	if (RenderedValid && line >= RenderedTop && line < RenderedTop + ROWS)
+		DirtyRows |= 1u << (int)(line - RenderedTop);
+}
+
+void Console::NewLine()
+{
+	// The slot of the oldest line is reused once the ring is full
+	if (End - First == (Uint64)Capacity)
+		First++;
+
+	SDL_memset4(LineCells(End), MakeCell(' ', Foreground, Background), COLS);
+	MarkDirty(End);
+	End++;
+	Column = 0;
+}
+
+void Console::Write(const char* str)
+{
+	Cell* line = LineCells(End - 1);
+
+	for (const byte* p = (const byte*)str; *p; p++)
+	{
+		const int chr = *p;
+
+		if (chr == '\n')
+		{
+			NewLine();
+			line = LineCells(End - 1);
+			continue;
+		}
+		if (chr == '\r')
+		{
+			Column = 0;
+			continue;
+		}
+		if (Column == COLS)
+		{
+			NewLine();
+			line = LineCells(End - 1);
+		}
+
+		line[Column++] = MakeCell(chr, Foreground, Background);
+		MarkDirty(End - 1);
+	}
+}
+
+void Console::Printf(const char* fmt, ...)
+{
+	char str[FMT_TO_STR_MAXLEN] = { 0 };
+	va_list arg;
+	va_start(arg, fmt);
+	vsnprintf(str, sizeof(str), fmt, arg);
+	va_end(arg);
+
+	Write(str);
+}
+
+void Console::ScrollTo(Uint64 line)
+{
+	Top = line;
+	Following = false;
+	ClampTop();
+}
+
+void Console::ScrollBy(int lines)
+{
+	ClampTop();
+
+	if (lines < 0 && (Uint64)-lines > Top - First)
+		Top = First;
+	else
+		Top += lines;
+
+	Following = false;
+	ClampTop();
+}
+
+void Console::Follow()
+{
+	Following = true;
+}
+
+bool Console::IsFollowing()
+{
+	return Following;
+}
+
+void Console::ClampTop()
+{
+	const Uint64 tail = End - First > ROWS ? End - ROWS : First;
+
+	if (Following || Top > tail)
+		Top = tail;
+	if (Top < First)
+		Top = First;
+}
+
+void Console::DrawRow(Graphics& gfx, int row)
+{
+	const Cell* line = GetLine(Top + row);
+
+	if (!line)
+	{
+		Cell blank[COLS];
+		SDL_memset4(blank, MakeCell(' ', CONSOLE_DEFAULT_FG, CONSOLE_DEFAULT_BG), COLS);
+		gfx.DrawCells(blank, COLS, 0, row);
+		return;
+	}
+
+	gfx.DrawCells(line, COLS, 0, row);
+}
+
+void Console::Render(Graphics& gfx)
+{
+	TRACE_SCOPE("Console::Render");
+	ClampTop();
+
+	Uint32 dirty = DirtyRows;
+	const Uint32 allRows = 0xffffffff >> (32 - ROWS);
+
+	if (!RenderedValid)
+	{
+		dirty = allRows;
+	}
+	else if (Top > RenderedTop)
+	{
+		const Uint64 delta = Top - RenderedTop;
+
+		if (delta >= ROWS)
+		{
+			dirty = allRows;
+		}
+		else
+		{
+			gfx.ScrollBuffer((int)delta * CHAR_H);
+			dirty = (dirty >> delta) | (allRows & ~(allRows >> delta));
+		}
+	}
+	else if (Top < RenderedTop)
+	{
+		const Uint64 delta = RenderedTop - Top;
+
+		if (delta >= ROWS)
+		{
+			dirty = allRows;
+		}
+		else
+		{
+			gfx.ScrollBuffer(-(int)delta * CHAR_H);
+			dirty = ((dirty << delta) & allRows) | ((1u << delta) - 1);
+		}
+	}
+
+	for (int row = 0; row < ROWS; row++)
+		if (dirty & (1u << row))
+			DrawRow(gfx, row);
+
+	RenderedTop = Top;
+	RenderedValid = true;
+	DirtyRows = 0;
+}
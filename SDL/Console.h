@@ -0,0 +1,60 @@
+#ifndef _CONSOLE_H_
+#define _CONSOLE_H_
+
+#include "Graphics.h"
+
+#define CONSOLE_DEFAULT_FG 7
+#define CONSOLE_DEFAULT_BG 0
+
+// Scrollback log with a fixed number of lines kept in a ring of packed
+// cells. Lines are addressed by absolute number; once the ring is full the
+// oldest line is dropped. Render() scrolls the framebuffer with a single
+// row move and only rasterizes the lines that scrolled into view or were
+// written since the last frame.
+class Console
+{
+public:
+	Console(int capacity);
+	~Console();
+
+	void Write(const char* str);
+	void Printf(const char* fmt, ...);
+	void SetColor(int forecolor, int backcolor);
+	void Clear();
+
+	void ScrollTo(Uint64 line);
+	void ScrollBy(int lines);
+	void Follow();
+	bool IsFollowing();
+
+	Uint64 FirstLine();
+	Uint64 LineCount();
+	Uint64 TopLine();
+	const Cell* GetLine(Uint64 line);
+
+	void Render(Graphics& gfx);
+	void Invalidate();
+
+private:
+	Cell* Lines;
+	int Capacity;
+	Uint64 First;
+	Uint64 End;
+	int Column;
+	Uint64 Top;
+	bool Following;
+	int Foreground;
+	int Background;
+
+	bool RenderedValid;
+	Uint64 RenderedTop;
+	Uint32 DirtyRows;
+
+	Cell* LineCells(Uint64 line);
+	void NewLine();
+	void MarkDirty(Uint64 line);
+	void ClampTop();
+	void DrawRow(Graphics& gfx, int row);
+};
+
+#endif
@@ -0,0 +1,195 @@
+#include <stdlib.h>
+#include "Font.h"
+#include "MappedFile.h"
+
+static Uint32 ReadLE32(const Uint8* p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((Uint32)p[3] << 24);
+}
+
+Font::Font()
+{
+	SDL_memset(Glyphs, 0, sizeof(Glyphs));
+	Height = 0;
+	GlyphCount = 0;
+}
+
+bool Font::Load(const char* filename)
+{
+	MappedFile file;
+	if (!file.Open(filename))
+		return false;
+
+	const Uint8* data = file.Data();
+	const size_t size = file.Size();
+
+	if (size >= 4 && (ReadLE32(data) == PSF2_MAGIC || (data[0] | (data[1] << 8)) == PSF1_MAGIC))
+		return ParsePSF(data, size);
+
+	return ParseBDF((const char*)data, size);
+}
+
+bool Font::ParsePSF(const Uint8* data, size_t size)
+{
+	Uint32 headerSize, count, glyphSize, height, width;
+
+	if (size >= 4 && (data[0] | (data[1] << 8)) == PSF1_MAGIC)
+	{
+		headerSize = 4;
+		count = data[2] & PSF1_MODE512 ? 512 : 256;
+		height = data[3];
+		width = 8;
+		glyphSize = height;
+	}
+	else if (size >= 32 && ReadLE32(data) == PSF2_MAGIC)
+	{
+		headerSize = ReadLE32(data + 8);
+		count = ReadLE32(data + 16);
+		glyphSize = ReadLE32(data + 20);
+		height = ReadLE32(data + 24);
+		width = ReadLE32(data + 28);
+	}
+	else
+	{
+		return false;
+	}
+
+	const Uint32 pitch = (width + 7) / 8;
+
+	if (width == 0 || width > CHAR_W || height == 0 || height > FONT_MAX_HEIGHT || glyphSize < pitch * height ||
+		count == 0 || headerSize > size || (size - headerSize) / glyphSize < count)
+		return false;
+
+	Height = height;
+	GlyphCount = SDL_min((int)count, FONT_MAX_GLYPHS);
+	SDL_memset(Glyphs, 0, sizeof(Glyphs));
+
+	for (int chr = 0; chr < GlyphCount; chr++)
+	{
+		const Uint8* glyph = data + headerSize + (size_t)chr * glyphSize;
+		for (Uint32 row = 0; row < height; row++)
+			Glyphs[chr][row] = glyph[row * pitch];
+	}
+
+	return true;
+}
+
+// Reads the next line into a NUL-terminated buffer, returning false at the end
+static bool NextLine(const char*& p, const char* end, char* line, size_t capacity)
+{
+	if (p >= end)
+		return false;
+
+	size_t length = 0;
+	while (p < end && *p != '\n')
+	{
+		if (length + 1 < capacity && *p != '\r')
+			line[length++] = *p;
+		p++;
+	}
+
+	line[length] = '\0';
+	if (p < end)
+		p++;
+
+	return true;
+}
+
+static bool StartsWith(const char* line, const char* keyword)
+{
+	const size_t length = SDL_strlen(keyword);
+	return SDL_strncmp(line, keyword, length) == 0 && (line[length] == ' ' || line[length] == '\0');
+}
+
+bool Font::ParseBDF(const char* text, size_t size)
+{
+	const char* p = text;
+	const char* end = text + size;
+	char line[256];
+
+	int boxW = 0, boxH = 0, boxX = 0, boxY = 0;
+	bool haveBox = false;
+
+	while (NextLine(p, end, line, sizeof(line)))
+	{
+		if (StartsWith(line, "FONTBOUNDINGBOX"))
+		{
+			haveBox = SDL_sscanf(line + 15, "%d %d %d %d", &boxW, &boxH, &boxX, &boxY) == 4;
+			break;
+		}
+		if (StartsWith(line, "STARTCHAR"))
+			return false;
+	}
+
+	if (!haveBox || boxW <= 0 || boxW > CHAR_W || boxH <= 0 || boxH > FONT_MAX_HEIGHT)
+		return false;
+
+	// Glyphs are parsed into scratch so a malformed file leaves the font as it was
+	static thread_local byte glyphs[FONT_MAX_GLYPHS][FONT_MAX_HEIGHT];
+	int glyphCount = 0;
+	SDL_memset(glyphs, 0, sizeof(glyphs));
+
+	// Rows are placed so every glyph shares the bounding box baseline
+	const int ascent = boxH + boxY;
+	int encoding = -1;
+	int w = 0, h = 0, x = 0, y = 0;
+	int row = 0;
+	bool inBitmap = false;
+
+	while (NextLine(p, end, line, sizeof(line)))
+	{
+		if (StartsWith(line, "ENCODING"))
+		{
+			encoding = atoi(line + 8);
+		}
+		else if (StartsWith(line, "BBX"))
+		{
+			if (SDL_sscanf(line + 3, "%d %d %d %d", &w, &h, &x, &y) != 4)
+				return false;
+		}
+		else if (StartsWith(line, "BITMAP"))
+		{
+			row = ascent - (h + y);
+			inBitmap = true;
+		}
+		else if (StartsWith(line, "ENDCHAR"))
+		{
+			inBitmap = false;
+			encoding = -1;
+		}
+		else if (inBitmap)
+		{
+			const int shift = x - boxX;
+
+			if (encoding >= 0 && encoding < FONT_MAX_GLYPHS && row >= 0 && row < boxH && shift >= 0)
+			{
+				char digits[3] = { line[0], line[0] ? line[1] : '\0', '\0' };
+				const int bits = (int)SDL_strtol(digits, NULL, 16);
+				glyphs[encoding][row] = (byte)(bits >> shift);
+				glyphCount = SDL_max(glyphCount, encoding + 1);
+			}
+
+			row++;
+		}
+	}
+
+	if (glyphCount == 0)
+		return false;
+
+	SDL_memcpy(Glyphs, glyphs, sizeof(Glyphs));
+	Height = boxH;
+	GlyphCount = glyphCount;
+	return true;
+}
+
+bool Font::CopyToCharset(Graphics& gfx) const
+{
+	if (Height != CHAR_H)
+		return false;
+
+	for (int chr = 0; chr < GlyphCount; chr++)
+		SDL_memcpy(gfx.Charset[chr], Glyphs[chr], CHAR_H);
+
+	gfx.InvalidateGlyphCache();
+	return true;
+}
@@ -0,0 +1,37 @@
+#ifndef _FONT_H_
+#define _FONT_H_
+
+#include "Graphics.h"
+
+#define FONT_MAX_GLYPHS CHARSET_SIZE
+#define FONT_MAX_HEIGHT 32
+
+#define PSF1_MAGIC 0x0436
+#define PSF1_MODE512 0x01
+#define PSF2_MAGIC 0x864ab572
+
+// Bitmap font of 8-pixel-wide glyphs with any height up to FONT_MAX_HEIGHT,
+// imported from Linux console PSF1/PSF2 files or X11 BDF files. Files are
+// memory-mapped and parsed in place. Glyphs narrower than 8 pixels are
+// left-aligned; wider fonts are rejected.
+class Font
+{
+public:
+	byte Glyphs[FONT_MAX_GLYPHS][FONT_MAX_HEIGHT];
+	int Height;
+	int GlyphCount;
+
+	Font();
+
+	bool Load(const char* filename);
+	bool ParsePSF(const Uint8* data, size_t size);
+	bool ParseBDF(const char* text, size_t size);
+	bool CopyToCharset(Graphics& gfx) const;
+
+	inline const byte* GetGlyph(int chr) const
+	{
+		return Glyphs[(unsigned int)chr < (unsigned int)GlyphCount ? chr : 0];
+	}
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "FrameProfiler.h"
+
+FrameProfiler::FrameProfiler()
+{
+	Frequency = SDL_GetPerformanceFrequency();
+	Callback = NULL;
+	Reset();
+}
+
+void FrameProfiler::Add(FramePhase phase, Uint64 ticks)
+{
+	Current.Ticks[phase] += ticks;
+}
+
+void FrameProfiler::EndFrame()
+{
+	Window[Head] = Current;
+	Head = (Head + 1) % FRAME_STATS_WINDOW;
+	if (Count < FRAME_STATS_WINDOW)
+		Count++;
+
+	if (Callback)
+		Callback(Current, Frequency);
+
+	SDL_memset(&Current, 0, sizeof(Current));
+}
+
+void FrameProfiler::GetStats(FrameStats& stats)
+{
+	SDL_memset(&stats, 0, sizeof(stats));
+	stats.Frames = Count;
+
+	if (Count == 0)
+		return;
+
+	const double usPerTick = 1000000.0 / (double)Frequency;
+	const int last = (Head + FRAME_STATS_WINDOW - 1) % FRAME_STATS_WINDOW;
+
+	for (int phase = 0; phase < PHASE_COUNT; phase++)
+	{
+		Uint64 total = 0;
+		Uint64 min = Window[last].Ticks[phase];
+		Uint64 max = min;
+
+		for (int i = 0; i < Count; i++)
+		{
+			const Uint64 ticks = Window[i].Ticks[phase];
+			total += ticks;
+			if (ticks < min) min = ticks;
+			if (ticks > max) max = ticks;
+		}
+
+		stats.Last[phase] = Window[last].Ticks[phase] * usPerTick;
+		stats.Average[phase] = (double)total / Count * usPerTick;
+		stats.Min[phase] = min * usPerTick;
+		stats.Max[phase] = max * usPerTick;
+	}
+}
+
+void FrameProfiler::SetCallback(FrameTimingCallback callback)
+{
+	Callback = callback;
+}
+
+void FrameProfiler::Reset()
+{
+	SDL_memset(&Current, 0, sizeof(Current));
+	Head = 0;
+	Count = 0;
+}
@@ -0,0 +1,65 @@
+#ifndef _FRAMEPROFILER_H_
+#define _FRAMEPROFILER_H_
+
+#include <SDL.h>
+
+#define FRAME_STATS_WINDOW 120
+
+enum FramePhase
+{
+	PHASE_CLEAR = 0,
+	PHASE_DRAW,
+	PHASE_UPLOAD,
+	PHASE_RENDER,
+	PHASE_PRESENT,
+	PHASE_COUNT
+};
+
+struct FrameTiming
+{
+	Uint64 Ticks[PHASE_COUNT];
+};
+
+// Phase times in microseconds, over the last FRAME_STATS_WINDOW frames
+struct FrameStats
+{
+	int Frames;
+	double Last[PHASE_COUNT];
+	double Average[PHASE_COUNT];
+	double Min[PHASE_COUNT];
+	double Max[PHASE_COUNT];
+};
+
+typedef void(*FrameTimingCallback)(const FrameTiming& timing, Uint64 ticksPerSecond);
+
+class FrameProfiler
+{
+public:
+	FrameProfiler();
+
+	void Add(FramePhase phase, Uint64 ticks);
+	void EndFrame();
+	void GetStats(FrameStats& stats);
+	void SetCallback(FrameTimingCallback callback);
+	void Reset();
+
+private:
+	FrameTiming Current;
+	FrameTiming Window[FRAME_STATS_WINDOW];
+	int Head;
+	int Count;
+	Uint64 Frequency;
+	FrameTimingCallback Callback;
+};
+
+#ifdef GRAPHICS_PROFILE
+#define PROFILE_BEGIN(phase) const Uint64 _profile_##phase = SDL_GetPerformanceCounter()
+#define PROFILE_END(profiler, phase) (profiler).Add(phase, SDL_GetPerformanceCounter() - _profile_##phase)
+#define PROFILE_END_FRAME(profiler) (profiler).EndFrame()
+#else
+#define PROFILE_BEGIN(phase)
+#define PROFILE_END(profiler, phase)
+#define PROFILE_END_FRAME(profiler)
+#endif
+
+#endif
@@ -0,0 +1,280 @@
+#include <algorithm>
+#include "GlyphMap.h"
+#include "Simd.h"
+
+#define EMPTY_KEY 0xffffffff
+#define BUCKET_KEYS 4
+#define MAX_DISPLACEMENT 0xffff
+#define UNMAPPED_GLYPH 0xffff
+
+static inline Uint32 HashCodepoint(Uint32 codepoint, Uint32 seed)
+{
+	Uint32 h = codepoint ^ (seed * 0x9e3779b9u);
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+GlyphMap::GlyphMap()
+{
+	for (int i = 0; i < GLYPHMAP_LATIN1; i++)
+		Latin1[i] = i;
+
+	Fallback = GLYPHMAP_DEFAULT_FALLBACK;
+	Dirty = false;
+	SlotMask = 0;
+}
+
+void GlyphMap::Map(Uint32 codepoint, int glyph)
+{
+	if (glyph < 0 || glyph >= GLYPHMAP_GLYPHS)
+		return;
+
+	if (codepoint < GLYPHMAP_LATIN1)
+	{
+		Latin1[codepoint] = glyph;
+		return;
+	}
+
+	for (size_t i = 0; i < PendingKeys.size(); i++)
+	{
+		if (PendingKeys[i] == codepoint)
+		{
+			PendingValues[i] = glyph;
+			Dirty = true;
+			return;
+		}
+	}
+
+	PendingKeys.push_back(codepoint);
+	PendingValues.push_back(glyph);
+	Dirty = true;
+}
+
+void GlyphMap::Unmap(Uint32 codepoint)
+{
+	if (codepoint < GLYPHMAP_LATIN1)
+	{
+		Latin1[codepoint] = UNMAPPED_GLYPH;
+		return;
+	}
+
+	for (size_t i = 0; i < PendingKeys.size(); i++)
+	{
+		if (PendingKeys[i] == codepoint)
+		{
+			PendingKeys.erase(PendingKeys.begin() + i);
+			PendingValues.erase(PendingValues.begin() + i);
+			Dirty = true;
+			return;
+		}
+	}
+}
+
+void GlyphMap::SetFallback(int glyph)
+{
+	if (glyph >= 0 && glyph < GLYPHMAP_GLYPHS)
+		Fallback = glyph;
+}
+
+int GlyphMap::GetFallback()
+{
+	return Fallback;
+}
+
+void GlyphMap::Build()
+{
+	// Hash and displace: keys are grouped into buckets by one hash and each
+	// bucket, largest first, searches for a seed that sends all its keys to
+	// free slots. A lookup is then two hashes and one compare.
+	Dirty = false;
+	const size_t count = PendingKeys.size();
+
+	Keys.clear();
+	Values.clear();
+	Displace.clear();
+	SlotMask = 0;
+
+	if (count == 0)
+		return;
+
+	size_t buckets = 1;
+	while (buckets * BUCKET_KEYS < count)
+		buckets <<= 1;
+
+	size_t slots = 1;
+	while (slots < count)
+		slots <<= 1;
+
+	std::vector<std::vector<size_t>> members(buckets);
+	for (size_t i = 0; i < count; i++)
+		members[HashCodepoint(PendingKeys[i], 0) & (buckets - 1)].push_back(i);
+
+	std::vector<size_t> order(buckets);
+	for (size_t i = 0; i < buckets; i++)
+		order[i] = i;
+	std::stable_sort(order.begin(), order.end(), [&members](size_t a, size_t b) { return members[a].size() > members[b].size(); });
+
+	while (true)
+	{
+		Keys.assign(slots, EMPTY_KEY);
+		Values.assign(slots, 0);
+		Displace.assign(buckets, 0);
+		SlotMask = (Uint32)slots - 1;
+
+		bool placedAll = true;
+
+		for (size_t b = 0; b < buckets && placedAll; b++)
+		{
+			const std::vector<size_t>& keys = members[order[b]];
+			if (keys.empty())
+				break;
+
+			bool placed = false;
+
+			for (Uint32 seed = 1; seed <= MAX_DISPLACEMENT && !placed; seed++)
+			{
+				placed = true;
+				for (size_t k = 0; k < keys.size() && placed; k++)
+				{
+					const Uint32 slot = HashCodepoint(PendingKeys[keys[k]], seed) & SlotMask;
+					if (Keys[slot] != EMPTY_KEY)
+						placed = false;
+					for (size_t j = 0; j < k && placed; j++)
+						if ((HashCodepoint(PendingKeys[keys[j]], seed) & SlotMask) == slot)
+							placed = false;
+				}
+
+				if (placed)
+				{
+					Displace[order[b]] = (Uint16)seed;
+					for (size_t k = 0; k < keys.size(); k++)
+					{
+						const Uint32 slot = HashCodepoint(PendingKeys[keys[k]], seed) & SlotMask;
+						Keys[slot] = PendingKeys[keys[k]];
+						Values[slot] = PendingValues[keys[k]];
+					}
+				}
+			}
+
+			placedAll = placed;
+		}
+
+		if (placedAll)
+			return;
+
+		slots <<= 1;
+	}
+}
+
+inline int GlyphMap::LookupHashed(Uint32 codepoint)
+{
+	if (Dirty)
+		Build();
+
+	if (Keys.empty())
+		return Fallback;
+
+	const Uint32 seed = Displace[HashCodepoint(codepoint, 0) & (Displace.size() - 1)];
+	const Uint32 slot = HashCodepoint(codepoint, seed) & SlotMask;
+	return Keys[slot] == codepoint ? Values[slot] : Fallback;
+}
+
+// Unmapped Latin-1 entries follow later SetFallback() calls
+inline int GlyphMap::LookupLatin1(Uint8 chr)
+{
+	const int glyph = Latin1[chr];
+	return glyph == UNMAPPED_GLYPH ? Fallback : glyph;
+}
+
+int GlyphMap::Lookup(Uint32 codepoint)
+{
+	return codepoint < GLYPHMAP_LATIN1 ? LookupLatin1(codepoint) : LookupHashed(codepoint);
+}
+
+int GlyphMap::Decode(const char* text, size_t length, Uint16* glyphs, int capacity)
+{
+	const Uint8* p = (const Uint8*)text;
+	const Uint8* end = p + length;
+	int count = 0;
+
+	while (p < end && count < capacity)
+	{
+#ifdef HAVE_SSE2
+		// Whole blocks of ASCII skip the decoder and go straight to the table
+		while (end - p >= 16 && capacity - count >= 16)
+		{
+			const __m128i block = _mm_loadu_si128((const __m128i*)p);
+			if (_mm_movemask_epi8(block))
+				break;
+
+			for (int i = 0; i < 16; i++)
+				glyphs[count + i] = LookupLatin1(p[i]);
+			p += 16;
+			count += 16;
+		}
+
+		if (p >= end || count >= capacity)
+			break;
+#endif
+
+		const Uint32 lead = *p;
+
+		if (lead < 0x80)
+		{
+			glyphs[count++] = LookupLatin1(lead);
+			p++;
+			continue;
+		}
+
+		int extra;
+		Uint32 codepoint;
+		Uint32 minimum;
+
+		if ((lead & 0xe0) == 0xc0)
+		{
+			extra = 1;
+			codepoint = lead & 0x1f;
+			minimum = 0x80;
+		}
+		else if ((lead & 0xf0) == 0xe0)
+		{
+			extra = 2;
+			codepoint = lead & 0x0f;
+			minimum = 0x800;
+		}
+		else if ((lead & 0xf8) == 0xf0)
+		{
+			extra = 3;
+			codepoint = lead & 0x07;
+			minimum = 0x10000;
+		}
+		else
+		{
+			glyphs[count++] = Fallback;
+			p++;
+			continue;
+		}
+
+		// A bad sequence costs one fallback glyph covering the lead and the
+		// continuation bytes that were read, then resyncs on the next byte
+		int i = 1;
+		for (; i <= extra && p + i < end && (p[i] & 0xc0) == 0x80; i++)
+			codepoint = (codepoint << 6) | (p[i] & 0x3f);
+
+		if (i <= extra || codepoint < minimum || codepoint > 0x10ffff || (codepoint >= 0xd800 && codepoint <= 0xdfff))
+		{
+			glyphs[count++] = Fallback;
+			p += i;
+			continue;
+		}
+
+		glyphs[count++] = Lookup(codepoint);
+		p += extra + 1;
+	}
+
+	return count;
+}
@@ -0,0 +1,46 @@
+#ifndef _GLYPHMAP_H_
+#define _GLYPHMAP_H_
+
+#include <stddef.h>
+#include <vector>
+#include <SDL.h>
+
+#define GLYPHMAP_LATIN1 256
+#define GLYPHMAP_GLYPHS 512
+#define GLYPHMAP_DEFAULT_FALLBACK '?'
+
+// Maps Unicode codepoints to charset slots. Latin-1 goes through a direct
+// table, initially the identity; other codepoints go through a perfect hash
+// that is rebuilt on the first lookup after the mapping changes. Anything
+// unmapped, and any malformed UTF-8, becomes the fallback glyph.
+class GlyphMap
+{
+public:
+	GlyphMap();
+
+	void Map(Uint32 codepoint, int glyph);
+	void Unmap(Uint32 codepoint);
+	void SetFallback(int glyph);
+	int GetFallback();
+	int Lookup(Uint32 codepoint);
+	int Decode(const char* text, size_t length, Uint16* glyphs, int capacity);
+
+private:
+	Uint16 Latin1[GLYPHMAP_LATIN1];
+	int Fallback;
+
+	std::vector<Uint32> PendingKeys;
+	std::vector<Uint16> PendingValues;
+	bool Dirty;
+
+	std::vector<Uint32> Keys;
+	std::vector<Uint16> Values;
+	std::vector<Uint16> Displace;
+	Uint32 SlotMask;
+
+	void Build();
+	int LookupHashed(Uint32 codepoint);
+	int LookupLatin1(Uint8 chr);
+};
+
+#endif
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include "GoldenImage.h"
+#include "Hash.h"
+
+#define OPAQUE 0xff000000
+#define DIFF_COLOR 0xffff0000
+
+static Uint32 Frame[SCREEN_H][SCREEN_W];
+
+static void CaptureFrame(Graphics& gfx)
+{
+	gfx.ReadPixels(&Frame[0][0], SCREEN_W * sizeof(Uint32));
+
+	// The texture is uploaded without blending, so alpha never reaches the screen
+	for (int y = 0; y < SCREEN_H; y++)
+		for (int x = 0; x < SCREEN_W; x++)
+			Frame[y][x] |= OPAQUE;
+}
+
+static bool SaveFrame(const Uint32* pixels, const std::string& filename)
+{
+	SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom((void*)pixels,
+		SCREEN_W, SCREEN_H, 32, SCREEN_W * sizeof(Uint32), SDL_PIXELFORMAT_ARGB8888);
+	if (!surface)
+		return false;
+
+	const bool saved = SDL_SaveBMP(surface, filename.c_str()) == 0;
+	SDL_FreeSurface(surface);
+	return saved;
+}
+
+GoldenImage::GoldenImage(const char* directory, bool record)
+{
+	Directory = directory;
+	Record = record;
+	FailureCount = 0;
+
+	// Recording keeps the hashes of scenes that are not re-run
+	Load();
+}
+
+Uint64 GoldenImage::HashFrame(Graphics& gfx)
+{
+	CaptureFrame(gfx);
+	return HashBytes(Frame, sizeof(Frame));
+}
+
+bool GoldenImage::Check(Graphics& gfx, const char* scene, SceneScript script)
+{
+	script(gfx);
+	gfx.Update();
+
+	const Uint64 hash = HashFrame(gfx);
+
+	if (Record)
+	{
+		Hashes[scene] = hash;
+		SaveFrame(&Frame[0][0], PathFor(scene, ".bmp"));
+		return true;
+	}
+
+	std::map<std::string, Uint64>::iterator golden = Hashes.find(scene);
+
+	if (golden == Hashes.end())
+	{
+		fprintf(stderr, "%s: no golden hash recorded\n", scene);
+		FailureCount++;
+		return false;
+	}
+
+	if (golden->second == hash)
+		return true;
+
+	fprintf(stderr, "%s: hash %016llx, expected %016llx\n", scene,
+		(unsigned long long)hash, (unsigned long long)golden->second);
+
+	SaveFrame(&Frame[0][0], PathFor(scene, ".actual.bmp"));
+	DumpDiff(scene, &Frame[0][0]);
+	FailureCount++;
+	return false;
+}
+
+bool GoldenImage::Save()
+{
+	FILE* fp = fopen((Directory + "/" + GOLDEN_HASH_FILE).c_str(), "w");
+	if (!fp)
+		return false;
+
+	for (std::map<std::string, Uint64>::iterator it = Hashes.begin(); it != Hashes.end(); ++it)
+		fprintf(fp, "%s %016llx\n", it->first.c_str(), (unsigned long long)it->second);
+
+	fclose(fp);
+	return true;
+}
+
+int GoldenImage::Failures()
+{
+	return FailureCount;
+}
+
+void GoldenImage::Load()
+{
+	FILE* fp = fopen((Directory + "/" + GOLDEN_HASH_FILE).c_str(), "r");
+	if (!fp)
+		return;
+
+	char scene[256];
+	unsigned long long hash;
+
+	while (fscanf(fp, "%255s %llx", scene, &hash) == 2)
+		Hashes[scene] = hash;
+
+	fclose(fp);
+}
+
+std::string GoldenImage::PathFor(const char* scene, const char* suffix)
+{
+	return Directory + "/" + scene + suffix;
+}
+
+void GoldenImage::DumpDiff(const char* scene, const Uint32* actual)
+{
+	SDL_Surface* loaded = SDL_LoadBMP(PathFor(scene, ".bmp").c_str());
+	if (!loaded)
+	{
+		fprintf(stderr, "%s: no reference bitmap, diff skipped\n", scene);
+		return;
+	}
+
+	SDL_Surface* reference = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_ARGB8888, 0);
+	SDL_FreeSurface(loaded);
+	if (!reference)
+		return;
+
+	if (reference->w != SCREEN_W || reference->h != SCREEN_H)
+	{
+		fprintf(stderr, "%s: reference bitmap is %dx%d, diff skipped\n", scene, reference->w, reference->h);
+		SDL_FreeSurface(reference);
+		return;
+	}
+
+	static Uint32 diff[SCREEN_H][SCREEN_W];
+	int differing = 0;
+
+	SDL_LockSurface(reference);
+
+	for (int y = 0; y < SCREEN_H; y++)
+	{
+		const Uint32* expected = (const Uint32*)((const Uint8*)reference->pixels + y * reference->pitch);
+
+		for (int x = 0; x < SCREEN_W; x++)
+		{
+			const Uint32 pixel = actual[y * SCREEN_W + x];
+
+			if ((pixel | OPAQUE) != (expected[x] | OPAQUE))
+			{
+				diff[y][x] = DIFF_COLOR;
+				differing++;
+			}
+			else
+			{
+				// Matching pixels are kept as a dimmed backdrop for orientation
+				diff[y][x] = OPAQUE | ((pixel >> 2) & 0x3f3f3f);
+			}
+		}
+	}
+
+	SDL_UnlockSurface(reference);
+	SDL_FreeSurface(reference);
+
+	fprintf(stderr, "%s: %d pixels differ\n", scene, differing);
+	SaveFrame(&diff[0][0], PathFor(scene, ".diff.bmp"));
+}
@@ -0,0 +1,39 @@
+#ifndef _GOLDENIMAGE_H_
+#define _GOLDENIMAGE_H_
+
+#include <map>
+#include <string>
+#include "Graphics.h"
+
+#define GOLDEN_HASH_FILE "golden.txt"
+
+typedef void(*SceneScript)(Graphics& gfx);
+
+// Renders scripted scenes and compares a hash of each resulting frame
+// against the hashes stored in <directory>/golden.txt. In record mode the
+// hashes and reference bitmaps of the scenes that run are rewritten and
+// all other entries are kept. On a mismatch the
+// actual frame and a diff against the reference bitmap are dumped.
+class GoldenImage
+{
+public:
+	GoldenImage(const char* directory, bool record);
+
+	bool Check(Graphics& gfx, const char* scene, SceneScript script);
+	bool Save();
+	int Failures();
+
+	static Uint64 HashFrame(Graphics& gfx);
+
+private:
+	std::string Directory;
+	bool Record;
+	int FailureCount;
+	std::map<std::string, Uint64> Hashes;
+
+	void Load();
+	std::string PathFor(const char* scene, const char* suffix);
+	void DumpDiff(const char* scene, const Uint32* actual);
+};
+
+#endif
@@ -0,0 +1,281 @@
+#include "GoldenScenes.h"
+#include "CellGrid.h"
+#include "Particles.h"
+#include "Canvas.h"
+
+struct GoldenScene
+{
+	const char* Name;
+	SceneScript Script;
+};
+
+// Scenes must not depend on rand() or the clock, so they share this LCG
+static Uint32 Seed;
+
+static Uint32 Next()
+{
+	Seed = Seed * 1664525 + 1013904223;
+	return Seed >> 8;
+}
+
+static void Reset(Graphics& gfx)
+{
+	gfx.SetMonochrome(false, 0xffffff, 0x000000);
+	gfx.SetDrawMode(DRAW_COPY);
+	gfx.SetupDefaultPalette();
+	gfx.Clear(0x000000);
+	Seed = 12345;
+}
+
+static void Backdrop(Graphics& gfx)
+{
+	for (int y = 0; y < SCREEN_H; y += 4)
+		gfx.FillRect(0, y, SCREEN_W, 2, 0x203040 + (y << 1));
+}
+
+static void GlyphRun(Graphics& gfx, int forecolor, int backcolor)
+{
+	// Every transform, at aligned, unaligned and clipped positions
+	for (int transform = 0; transform < GLYPH_TRANSFORMS; transform++)
+	{
+		const int y = 4 + transform * 22;
+		for (int i = 0; i < 12; i++)
+			gfx.DrawChar('A' + i + transform * 12, i * 21 + transform - 4, y + (i & 3), forecolor, backcolor, transform);
+		gfx.PutChar(256 + transform * 7, 31, transform * 3, backcolor, forecolor, transform);
+	}
+
+	gfx.DrawChar('@', -3, -5, forecolor, backcolor);
+	gfx.DrawChar('@', SCREEN_W - 5, SCREEN_H - 3, forecolor, backcolor);
+}
+
+static void MakeImage(Uint32* pixels, int w, int h, bool premultiplied)
+{
+	for (int y = 0; y < h; y++)
+	{
+		for (int x = 0; x < w; x++)
+		{
+			const Uint32 a = (x * 255) / (w - 1);
+			Uint32 r = (y * 255) / (h - 1);
+			Uint32 g = 255 - r;
+			Uint32 b = (x * y) & 0xff;
+
+			if (premultiplied)
+			{
+				r = r * a / 255;
+				g = g * a / 255;
+				b = b * a / 255;
+			}
+
+			pixels[y * w + x] = (a << 24) | (r << 16) | (g << 8) | b;
+		}
+	}
+
+	// A key-coloured stripe for the colour-key blit
+	for (int x = 0; x < w; x++)
+		pixels[(h / 2) * w + x] = 0x00ff00ff;
+}
+
+static void Blit(Graphics& gfx, BlendMode mode)
+{
+	static Uint32 image[30][40];
+	MakeImage(&image[0][0], 40, 30, mode == BLEND_PREMULTIPLIED);
+	Backdrop(gfx);
+
+	gfx.BlitImage(&image[0][0], 40, 30, sizeof(image[0]), 13, 7, mode, 0xff00ff);
+	gfx.BlitImage(&image[0][0], 40, 30, sizeof(image[0]), -11, 150, mode, 0xff00ff);
+	gfx.BlitImage(&image[0][0], 40, 30, sizeof(image[0]), 230, -9, mode, 0xff00ff);
+	gfx.BlitImage(&image[0][0], 37, 30, sizeof(image[0]), 101, 99, mode, 0xff00ff);
+}
+
+static void SceneClear(Graphics& gfx)
+{
+	gfx.Clear(0x3366cc);
+}
+
+static void ScenePrint(Graphics& gfx)
+{
+	gfx.Print(0, 0, 0xffffff, 0x000080, "Hello, world! 0123456789");
+	gfx.Print(3, 5, 0xffff00, 0x400000, "Glyphs %d-%d: \x80\x9f\xb0\xdb\xfe", 128, 255);
+	gfx.Print(28, 23, 0x00ff00, 0x000000, "clipped past the edge");
+
+	for (int row = 8; row < 16; row++)
+		for (int col = 0; col < COLS; col++)
+			gfx.PutChar((row - 8) * COLS + col, col, row, gfx.Palette[row], gfx.Palette[col + 16]);
+}
+
+static void SceneDrawCopy(Graphics& gfx)
+{
+	Backdrop(gfx);
+	GlyphRun(gfx, 0xffcc00, 0x102030);
+}
+
+static void SceneDrawOr(Graphics& gfx)
+{
+	Backdrop(gfx);
+	gfx.SetDrawMode(DRAW_OR);
+	GlyphRun(gfx, 0x00ffcc, 0x102030);
+}
+
+static void SceneDrawXor(Graphics& gfx)
+{
+	Backdrop(gfx);
+	gfx.SetDrawMode(DRAW_XOR);
+	GlyphRun(gfx, 0xff00ff, 0x102030);
+	GlyphRun(gfx, 0x00ffff, 0x102030);
+}
+
+static void SceneBlitColorKey(Graphics& gfx)
+{
+	Blit(gfx, BLEND_COLORKEY);
+}
+
+static void SceneBlitAlpha(Graphics& gfx)
+{
+	Blit(gfx, BLEND_ALPHA);
+}
+
+static void SceneBlitPremultiplied(Graphics& gfx)
+{
+	Blit(gfx, BLEND_PREMULTIPLIED);
+}
+
+static void SceneShapes(Graphics& gfx)
+{
+	const SDL_Point star[] = { { 128, 10 }, { 150, 80 }, { 220, 80 }, { 160, 120 }, { 190, 185 }, { 128, 145 }, { 66, 185 }, { 96, 120 }, { 36, 80 }, { 106, 80 } };
+	const SDL_Point tall[] = { { 20, -100000 }, { 60, 190 }, { 5, 150 } };
+
+	gfx.FillPolygon(star, 10, 0x804000);
+	gfx.DrawPolygon(star, 10, 0xffff00);
+	gfx.FillPolygon(tall, 3, 0x008060);
+	gfx.FillCircle(200, 40, 30, 0x2060ff);
+	gfx.DrawCircle(200, 40, 36, 0xffffff);
+	gfx.FillEllipse(60, 40, 50, 20, 0x60ff20);
+	gfx.DrawEllipse(60, 40, 55, 25, 0xff2060);
+	gfx.DrawRect(-5, 100, 60, 50, 0xff8000);
+	gfx.FillRect(230, 150, 50, 60, 0x8000ff);
+
+	for (int i = 0; i < 16; i++)
+		gfx.DrawLine(128, 96, (int)(Next() % 400) - 72, (int)(Next() % 300) - 54, gfx.Palette[i + 1]);
+}
+
+static void SceneMono(Graphics& gfx)
+{
+	gfx.SetMonochrome(true, 0xffffff, 0x000000);
+	gfx.Clear(0x000000);
+	GlyphRun(gfx, 0xffffff, 0x000000);
+	gfx.FillCircle(128, 96, 40, 0xffffff);
+	gfx.SetDrawMode(DRAW_XOR);
+	gfx.FillRect(100, 70, 60, 50, 0xffffff);
+	gfx.Print(2, 22, 0xffffff, 0x000000, "XOR text over mono");
+	gfx.SetDrawMode(DRAW_COPY);
+
+	static Uint32 image[30][40];
+	MakeImage(&image[0][0], 40, 30, false);
+	gfx.BlitImage(&image[0][0], 40, 30, sizeof(image[0]), 203, 151, BLEND_ALPHA);
+}
+
+static void SceneCells(Graphics& gfx)
+{
+	static Cell cells[30][40];
+	for (int y = 0; y < 30; y++)
+		for (int x = 0; x < 40; x++)
+			cells[y][x] = MakeCell(Next() % CHARSET_SIZE, Next() % PALETTE_SIZE, Next() % PALETTE_SIZE, Next() & 0x0f);
+
+	gfx.DrawCellBlock(&cells[0][0], 40, -3, -2, 40, 30);
+	gfx.DrawCells(cells[5], 10, 20, 20);
+
+	CellGrid grid;
+	grid.Fill(MakeCell('.', 8, 0));
+	grid.Print(1, 1, 15, 4, "CellGrid");
+	gfx.DrawCellBlock(&grid.Cells[0][0], COLS, 4, 8, 12, 4);
+}
+
+static void SceneParticles(Graphics& gfx)
+{
+	ParticleSystem particles(4000);
+	particles.SetGravity(0, 0.05f);
+
+	for (int i = 0; i < 4000; i++)
+	{
+		const float vx = ((int)(Next() % 2001) - 1000) / 400.0f;
+		const float vy = ((int)(Next() % 2001) - 1200) / 400.0f;
+		particles.Emit(128, 96, vx, vy, 10 + Next() % 60, gfx.Palette[16 + Next() % 216]);
+	}
+
+	for (int frame = 0; frame < 40; frame++)
+		particles.Update();
+
+	particles.Render(gfx);
+}
+
+static void SceneUtf8(Graphics& gfx)
+{
+	gfx.Codepoints.Map(0x2588, 219);
+	gfx.Codepoints.Map(0x263a, 1);
+	gfx.PrintUtf8(0, 0, 0xffffff, 0x000000, "Caf\xc3\xa9 na\xc3\xafve \xe2\x98\xba \xe2\x96\x88\xe2\x96\x88");
+	gfx.PrintUtf8(0, 2, 0xff8080, 0x000000, "bad: \xe2\x82" "A \xc0\xaf \xed\xa0\x80 \xf0\x9f\x98\x80");
+	gfx.PrintUtf8(0, 4, 0x80ff80, 0x000000, "%s", "0123456789abcdefghijklmnopqrstuv");
+	gfx.Codepoints.Unmap(0x2588);
+	gfx.Codepoints.Unmap(0x263a);
+}
+
+static void SceneCanvas(Graphics& gfx)
+{
+	Canvas panel(gfx, 100, 60);
+	panel.Clear(0x202020);
+	panel.DrawRect(0, 0, 100, 60, 0xffffff);
+	panel.Print(1, 1, 0xffff00, 0x202020, "Panel");
+	panel.PutCell(MakeCell('R', 9, 4, CELL_ATTR_REVERSE | GLYPH_ROTATE_90), 2, 3);
+	panel.DrawLine(0, 59, 99, 0, 0x00ff00);
+	panel.FillCircle(80, 40, 14, 0x2060ff);
+	panel.DrawEllipse(30, 45, 25, 10, 0xff8000);
+
+	const SDL_Point wedge[] = { { 60, 10 }, { 98, 20 }, { 70, 58 } };
+	panel.FillPolygon(wedge, 3, 0x804080);
+
+	gfx.SetDrawMode(DRAW_XOR);
+	for (int transform = 0; transform < GLYPH_TRANSFORMS; transform++)
+		panel.DrawChar('F', 4 + transform * 11, 48, 0xffffff, 0x000000, transform);
+	gfx.SetDrawMode(DRAW_COPY);
+
+	Backdrop(gfx);
+	gfx.DrawCanvas(panel, 10, 10);
+	gfx.DrawCanvas(panel, -40, 150);
+	gfx.DrawCanvas(panel, 200, 100);
+}
+
+static const GoldenScene Scenes[] =
+{
+	{ "clear", SceneClear },
+	{ "print", ScenePrint },
+	{ "draw_copy", SceneDrawCopy },
+	{ "draw_or", SceneDrawOr },
+	{ "draw_xor", SceneDrawXor },
+	{ "blit_colorkey", SceneBlitColorKey },
+	{ "blit_alpha", SceneBlitAlpha },
+	{ "blit_premultiplied", SceneBlitPremultiplied },
+	{ "shapes", SceneShapes },
+	{ "mono", SceneMono },
+	{ "cells", SceneCells },
+	{ "particles", SceneParticles },
+	{ "utf8", SceneUtf8 },
+	{ "canvas", SceneCanvas },
+};
+
+int RunGoldenScenes(Graphics& gfx, const char* directory, bool record)
+{
+	GoldenImage golden(directory, record);
+
+	for (size_t i = 0; i < sizeof(Scenes) / sizeof(Scenes[0]); i++)
+	{
+		Reset(gfx);
+		golden.Check(gfx, Scenes[i].Name, Scenes[i].Script);
+	}
+
+	Reset(gfx);
+
+	if (record && !golden.Save())
+		return -1;
+
+	return golden.Failures();
+}
@@ -0,0 +1,14 @@
+#ifndef _GOLDENSCENES_H_
+#define _GOLDENSCENES_H_
+
+#include "GoldenImage.h"
+
+#define GOLDEN_DIRECTORY "golden"
+
+// Renders every built-in scene through a GoldenImage harness rooted at
+// directory and returns the number of mismatches. In record mode the
+// hashes are written back to <directory>/golden.txt, and -1 means that
+// file could not be written. Tools/GoldenRun.cpp is the headless runner.
+int RunGoldenScenes(Graphics& gfx, const char* directory, bool record);
+
+#endif
@@ -1,16 +1,109 @@
 #include <stdio.h>
 #include <stdarg.h>
+#include <algorithm>
+#include <vector>
 #include "Graphics.h"
+#include "DefaultCharset.h"
+#include "Simd.h"
+#include "Hash.h"
+#include "Compress.h"
+#include "Font.h"
+#include "Canvas.h"
+#include "LatencyProbe.h"
+#include "AssetLoader.h"
+#include "Scheduler.h"
 
 #define FMT_TO_STR_MAXLEN 1024
 
 const int ScreenBufferSize = sizeof(int) * SCREEN_W * SCREEN_H;
 
-Graphics::Graphics(int bgcolor, bool fullscreen)
+static byte BitReverse[256];
+
+static void InitBitReverse()
+{
+	for (int i = 0; i < 256; i++)
+	{
+		byte reversed = 0;
+		for (int bit = 0; bit < 8; bit++)
+			if (i & (1 << bit))
+				reversed |= 0x80 >> bit;
+		BitReverse[i] = reversed;
+	}
+}
+
+static void TransposeGlyph(byte* rows)
+{
+	Uint64 bits = 0;
+	for (int i = 0; i < 8; i++)
+		bits = (bits << 8) | rows[i];
+
+	Uint64 t;
+	t = (bits ^ (bits >> 7)) & 0x00aa00aa00aa00aaULL;
+	bits ^= t ^ (t << 7);
+	t = (bits ^ (bits >> 14)) & 0x0000cccc0000ccccULL;
+	bits ^= t ^ (t << 14);
+	t = (bits ^ (bits >> 28)) & 0x00000000f0f0f0f0ULL;
+	bits ^= t ^ (t << 28);
+
+	for (int i = 7; i >= 0; i--, bits >>= 8)
+		rows[i] = (byte)bits;
+}
+
+inline void Graphics::Damage(int x, int y, int w, int h)
+{
+	if (!TargetScreen || !Snapshots.IsActive())
+		return;
+
+	if (x + w <= 0 || y + h <= 0 || x >= SCREEN_W || y >= SCREEN_H)
+		return;
+
+	Snapshots.Save(x / CHAR_W, y / CHAR_H, (x + w - 1) / CHAR_W, (y + h - 1) / CHAR_H);
+}
+
+// NULL points the rasterizers back at the screen
+void Graphics::SetTarget(const Surface* surface)
 {
-	Init(fullscreen);
-	ClearCharset();
-	LoadCharset(CHARSET_FILE);
+	TargetScreen = surface == NULL;
+
+	if (surface)
+	{
+		Target = *surface;
+		return;
+	}
+
+	Target.Pixels = &Buffer[0][0];
+	Target.Pitch = SCREEN_W;
+	Target.Clip.x = 0;
+	Target.Clip.y = 0;
+	Target.Clip.w = SCREEN_W;
+	Target.Clip.h = SCREEN_H;
+}
+
+// Canvases are always full colour, whatever the screen mode
+inline bool Graphics::DrawsMono() const
+{
+	return Monochrome && TargetScreen;
+}
+
+Graphics::Graphics(int bgcolor, bool fullscreen, bool headless)
+{
+	Monochrome = false;
+	MonoForeColor = 0xffffff;
+	MonoBackColor = 0x000000;
+	Mode = DRAW_COPY;
+	Probe = NULL;
+	Loader = NULL;
+	Tasks = NULL;
+	AutoDamage = false;
+	LastFrameValid = false;
+	DirtyCount = 0;
+	SetTarget(NULL);
+
+	InitBitReverse();
+	Init(fullscreen, headless);
+	SDL_memcpy(Charset, DefaultCharset, sizeof(Charset));
+	InvalidateGlyphCache();
+	SetupDefaultPalette();
 	Clear(bgcolor);
 }
 
@@ -19,8 +112,18 @@ Graphics::~Graphics()
 	Dispose();
 }
 
-void Graphics::Init(bool fullscreen)
+void Graphics::Init(bool fullscreen, bool headless)
 {
+	Window = NULL;
+	Renderer = NULL;
+	ScreenTexture = NULL;
+
+	if (headless)
+	{
+		SDL_Init(SDL_INIT_EVENTS);
+		return;
+	}
+
 	SDL_Init(SDL_INIT_EVERYTHING);
 	
 	SDL_SetHint(SDL_HINT_RENDER_DRIVER, "direct3d");
@@ -40,9 +143,12 @@ void Graphics::Init(bool fullscreen)
 
 void Graphics::Dispose()
 {
-	SDL_DestroyTexture(ScreenTexture);
-	SDL_DestroyRenderer(Renderer);
-	SDL_DestroyWindow(Window);
+	if (ScreenTexture)
+		SDL_DestroyTexture(ScreenTexture);
+	if (Renderer)
+		SDL_DestroyRenderer(Renderer);
+	if (Window)
+		SDL_DestroyWindow(Window);
 	SDL_Quit();
 }
 
@@ -50,10 +156,55 @@ void Graphics::ClearCharset()
 {
 	for (unsigned i = 0; i < CHARSET_SIZE; i++)
 		SetChar(i, 0, 0, 0, 0, 0, 0, 0, 0);
+
+	InvalidateGlyphCache();
+}
+
+void Graphics::InvalidateGlyphCache()
+{
+	SDL_memset(TransformedValid, 0, sizeof(TransformedValid));
+}
+
+const byte* Graphics::GetGlyph(int chr, int transform)
+{
+	if (transform == GLYPH_NORMAL)
+		return Charset[chr];
+
+	byte* rows = TransformedCharset[transform][chr];
+	Uint32& valid = TransformedValid[transform][chr >> 5];
+	const Uint32 bit = 1u << (chr & 31);
+
+	if (valid & bit)
+		return rows;
+
+	SDL_memcpy(rows, Charset[chr], CHAR_H);
+
+	// A 90 degree clockwise turn is a transpose followed by a horizontal flip
+	if (transform & GLYPH_ROTATE_90)
+	{
+		TransposeGlyph(rows);
+		for (int i = 0; i < CHAR_H; i++)
+			rows[i] = BitReverse[rows[i]];
+	}
+	if (transform & GLYPH_FLIP_X)
+	{
+		for (int i = 0; i < CHAR_H; i++)
+			rows[i] = BitReverse[rows[i]];
+	}
+	if (transform & GLYPH_FLIP_Y)
+	{
+		std::reverse(rows, rows + CHAR_H);
+	}
+
+	valid |= bit;
+	return rows;
 }
 
 void Graphics::ToggleFullscreen()
 {
+	if (!Window)
+		return;
+
 	Uint32 fullscreenFlag = SDL_WINDOW_FULLSCREEN_DESKTOP;
 	Uint32 isFullscreen = SDL_GetWindowFlags(Window) & fullscreenFlag;
 	SDL_SetWindowFullscreen(Window, isFullscreen ? 0 : fullscreenFlag);
@@ -61,28 +212,307 @@ void Graphics::ToggleFullscreen()
 }
 
 void Graphics::Update()
+{
+	// Responses stay pending while AutoDamage skips unchanged frames
+	const bool presented = Renderer && Present();
+
+	if (Probe && presented)
+		Probe->OnPresent();
+
+	if (Loader)
+		Loader->Publish();
+
+	if (Tasks)
+		Tasks->Tick();
+
+	// Headless frames never present, so the end of Update() stands in
+	if (Probe && !Renderer)
+		Probe->OnPresent();
+
+	PROFILE_END_FRAME(Profiler);
+}
+
+bool Graphics::Present()
 {
 	static int pitch;
 	static void* pixels;
 
-	SDL_LockTexture(ScreenTexture, NULL, &pixels, &pitch);
-	SDL_memcpy(pixels, Buffer, ScreenBufferSize);
-	SDL_UnlockTexture(ScreenTexture);
+	PROFILE_BEGIN(PHASE_UPLOAD);
+	TRACE_BEGIN("Update copy");
+
+	if (AutoDamage && !DiffFrame())
+	{
+		TRACE_END("Update copy");
+		PROFILE_END(Profiler, PHASE_UPLOAD);
+		return false;
+	}
+
+	if (AutoDamage && !Monochrome)
+	{
+		for (int i = 0; i < DirtyCount; i++)
+		{
+			const SDL_Rect& rect = DirtyRects[i];
+			SDL_UpdateTexture(ScreenTexture, &rect, &Buffer[rect.y][rect.x], SCREEN_W * sizeof(int));
+		}
+	}
+	else
+	{
+		SDL_LockTexture(ScreenTexture, NULL, &pixels, &pitch);
+		if (Monochrome)
+			UploadMono((Uint32*)pixels, pitch);
+		else
+			SDL_memcpy(pixels, Buffer, ScreenBufferSize);
+		SDL_UnlockTexture(ScreenTexture);
+	}
+
+	TRACE_END("Update copy");
+	PROFILE_END(Profiler, PHASE_UPLOAD);
+
+	PROFILE_BEGIN(PHASE_RENDER);
+	TRACE_BEGIN("RenderCopy");
 	SDL_RenderCopy(Renderer, ScreenTexture, NULL, NULL);
+	TRACE_END("RenderCopy");
+	PROFILE_END(Profiler, PHASE_RENDER);
+
+	PROFILE_BEGIN(PHASE_PRESENT);
+	TRACE_BEGIN("RenderPresent");
 	SDL_RenderPresent(Renderer);
+	TRACE_END("RenderPresent");
+	PROFILE_END(Profiler, PHASE_PRESENT);
+	return true;
 }
 
-void Graphics::Clear(int color)
+void Graphics::SetAutoDamage(bool enabled)
+{
+	AutoDamage = enabled;
+	LastFrameValid = false;
+	DirtyCount = 0;
+}
+
+const SDL_Rect* Graphics::GetDirtyRects(int& count)
+{
+	count = DirtyCount;
+	return DirtyRects;
+}
+
+bool Graphics::DiffFrame()
 {
+	if (!LastFrameValid)
+	{
+		SDL_memset(TileDirty, 1, sizeof(TileDirty));
+		LastFrameValid = true;
+	}
+	else if (Monochrome)
+	{
+		SDL_memset(TileDirty, 0, sizeof(TileDirty));
+		for (int y = 0; y < SCREEN_H; y++)
+			for (int col = 0; col < COLS; col++)
+				if (MonoBuffer[y][col] != LastMono[y][col])
+					TileDirty[y / CHAR_H][col] = 1;
+	}
+	else
+	{
+		DiffTiles();
+	}
+
+	BuildDirtyRects();
+
+	if (Monochrome)
+	{
+		SDL_memcpy(LastMono, MonoBuffer, sizeof(LastMono));
+	}
+	else
+	{
+		for (int i = 0; i < DirtyCount; i++)
+		{
+			const SDL_Rect& rect = DirtyRects[i];
+			for (int y = rect.y; y < rect.y + rect.h; y++)
+				SDL_memcpy(&LastFrame[y][rect.x], &Buffer[y][rect.x], rect.w * sizeof(int));
+		}
+	}
+
+	return DirtyCount > 0;
+}
+
+void Graphics::DiffTiles()
+{
+	SDL_memset(TileDirty, 0, sizeof(TileDirty));
+
 	for (int y = 0; y < SCREEN_H; y++)
-		for (int x = 0; x < SCREEN_W; x++)
-			SetPixel(x, y, color);
+	{
+		byte* dirty = TileDirty[y / CHAR_H];
+		const int* current = Buffer[y];
+		const int* last = LastFrame[y];
+
+		for (int col = 0; col < COLS; col++, current += CHAR_W, last += CHAR_W)
+		{
+			if (dirty[col])
+				continue;
+
+#ifdef HAVE_SSE2
+			// One tile row is two 16-byte lanes
+			const __m128i equal = _mm_and_si128(
+				_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)current), _mm_loadu_si128((const __m128i*)last)),
+				_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(current + 4)), _mm_loadu_si128((const __m128i*)(last + 4))));
+			dirty[col] = _mm_movemask_epi8(equal) != 0xffff;
+#else
+			dirty[col] = SDL_memcmp(current, last, CHAR_W * sizeof(int)) != 0;
+#endif
+		}
+	}
+}
+
+void Graphics::BuildDirtyRects()
+{
+	// Rectangles reaching the previous tile row, which a matching run may extend
+	int open[COLS];
+	int openCount = 0;
+
+	DirtyCount = 0;
+
+	for (int row = 0; row < ROWS; row++)
+	{
+		int touched[COLS];
+		int touchedCount = 0;
+
+		for (int col = 0; col < COLS; col++)
+		{
+			if (!TileDirty[row][col])
+				continue;
+
+			int end = col;
+			while (end + 1 < COLS && TileDirty[row][end + 1])
+				end++;
+
+			const int x = col * CHAR_W;
+			const int w = (end - col + 1) * CHAR_W;
+			int index = -1;
+
+			for (int i = 0; i < openCount; i++)
+			{
+				if (DirtyRects[open[i]].x == x && DirtyRects[open[i]].w == w)
+				{
+					index = open[i];
+					break;
+				}
+			}
+
+			if (index >= 0)
+			{
+				DirtyRects[index].h += CHAR_H;
+			}
+			else
+			{
+				index = DirtyCount++;
+				DirtyRects[index].x = x;
+				DirtyRects[index].y = row * CHAR_H;
+				DirtyRects[index].w = w;
+				DirtyRects[index].h = CHAR_H;
+			}
+
+			touched[touchedCount++] = index;
+			col = end;
+		}
+
+		SDL_memcpy(open, touched, touchedCount * sizeof(int));
+		openCount = touchedCount;
+	}
+}
+
+void Graphics::Clear(int color)
+{
+	PROFILE_BEGIN(PHASE_CLEAR);
+	TRACE_BEGIN("Clear");
+	Damage(0, 0, SCREEN_W, SCREEN_H);
+
+	if (Monochrome)
+	{
+		SDL_memset(MonoBuffer, color != MonoBackColor ? 0xff : 0x00, sizeof(MonoBuffer));
+	}
+	else
+	{
+		for (int y = 0; y < SCREEN_H; y++)
+			for (int x = 0; x < SCREEN_W; x++)
+				SetPixel(x, y, color);
+	}
+
+	TRACE_END("Clear");
+	PROFILE_END(Profiler, PHASE_CLEAR);
+}
+
+void Graphics::ScrollBuffer(int pixels)
+{
+	// Positive values move the picture up. The exposed rows keep their old
+	// contents and are left for the caller to redraw.
+	if (pixels == 0)
+		return;
+
+	TRACE_SCOPE("ScrollBuffer");
+	Damage(0, 0, SCREEN_W, SCREEN_H);
+
+	const int rows = SCREEN_H - SDL_abs(pixels);
+	if (rows <= 0)
+		return;
+
+	const int src = pixels > 0 ? pixels : 0;
+	const int dst = pixels > 0 ? 0 : -pixels;
+
+	if (Monochrome)
+		SDL_memmove(MonoBuffer[dst], MonoBuffer[src], rows * sizeof(MonoBuffer[0]));
+	else
+		SDL_memmove(Buffer[dst], Buffer[src], rows * sizeof(Buffer[0]));
 }
 
 void Graphics::SetPixel(int x, int y, int color)
 {
-	if (x >= 0 && y >= 0 && x < SCREEN_W && y < SCREEN_H)
-		Buffer[y][x] = color;
+	const SDL_Rect& clip = Target.Clip;
+	if (x < clip.x || y < clip.y || x >= clip.x + clip.w || y >= clip.y + clip.h)
+		return;
+
+	Damage(x, y, 1, 1);
+
+	if (DrawsMono())
+	{
+		const byte bit = 0x80 >> (x & 7);
+
+		if (color != MonoBackColor)
+			MonoBuffer[y][x >> 3] |= bit;
+		else
+			MonoBuffer[y][x >> 3] &= ~bit;
+	}
+	else
+	{
+		Target.Pixels[(size_t)y * Target.Pitch + x] = color;
+	}
+}
+
+void Graphics::PlotPixels(const int* xs, const int* ys, const int* colors, int count)
+{
+	if (Monochrome)
+	{
+		for (int i = 0; i < count; i++)
+			SetPixel(xs[i], ys[i], colors[i]);
+		return;
+	}
+
+	PROFILE_BEGIN(PHASE_DRAW);
+	TRACE_BEGIN("PlotPixels");
+
+	// One unsigned compare per point covers both edges of each axis
+	for (int i = 0; i < count; i++)
+	{
+		const int x = xs[i];
+		const int y = ys[i];
+
+		if ((unsigned)x < SCREEN_W && (unsigned)y < SCREEN_H)
+		{
+			Damage(x, y, 1, 1);
+			Buffer[y][x] = colors[i];
+		}
+	}
+
+	TRACE_END("PlotPixels");
+	PROFILE_END(Profiler, PHASE_DRAW);
 }
 
 void Graphics::SetChar(int chr,
@@ -99,31 +529,348 @@ void Graphics::SetChar(int chr,
 	pixels[5] = row6;
 	pixels[6] = row7;
 	pixels[7] = row8;
+
+	for (int transform = 0; transform < GLYPH_TRANSFORMS; transform++)
+		TransformedValid[transform][chr >> 5] &= ~(1u << (chr & 31));
 }
 
-void Graphics::PutChar(int chr, int x, int y, int forecolor, int backcolor)
+void Graphics::PutChar(int chr, int x, int y, int forecolor, int backcolor, int transform)
 {
-	DrawChar(chr, x * CHAR_W, y * CHAR_H, forecolor, backcolor);
+	DrawChar(chr, x * CHAR_W, y * CHAR_H, forecolor, backcolor, transform);
 }
 
-void Graphics::DrawChar(int chr, int x, int y, int forecolor, int backcolor)
+void Graphics::PutCell(Cell cell, int x, int y)
 {
-	byte* pixels = Charset[chr];
+	const int attributes = CellAttributes(cell);
+	int forecolor = Palette[CellForeground(cell)];
+	int backcolor = Palette[CellBackground(cell)];
+
+	if (attributes & CELL_ATTR_REVERSE)
+		std::swap(forecolor, backcolor);
+
+	PutChar(CellGlyph(cell), x, y, forecolor, backcolor, attributes & CELL_ATTR_TRANSFORM);
+}
+
+void Graphics::DrawCells(const Cell* cells, int count, int x, int y)
+{
+	DrawCellBlock(cells, count, x, y, count, 1);
+}
+
+void Graphics::DrawCellBlock(const Cell* cells, int pitch, int x, int y, int w, int h)
+{
+	// Clip the block to the cell grid once instead of per pixel
+	int col1 = SDL_max(x, 0);
+	int row1 = SDL_max(y, 0);
+	const int col2 = SDL_min(x + w, COLS);
+	const int row2 = SDL_min(y + h, ROWS);
+
+	if (col1 >= col2 || row1 >= row2)
+		return;
+
+	if (Monochrome || Mode != DRAW_COPY)
+	{
+		for (int row = row1; row < row2; row++)
+			for (int col = col1; col < col2; col++)
+				PutCell(cells[(row - y) * pitch + col - x], col, row);
+		return;
+	}
+
+	PROFILE_BEGIN(PHASE_DRAW);
+	TRACE_BEGIN("DrawCellBlock");
+	Damage(col1 * CHAR_W, row1 * CHAR_H, (col2 - col1) * CHAR_W, (row2 - row1) * CHAR_H);
+
+	for (int row = row1; row < row2; row++)
+	{
+		const Cell* src = &cells[(row - y) * pitch + col1 - x];
+		int* dst = &Buffer[row * CHAR_H][col1 * CHAR_W];
+
+		for (int col = col1; col < col2; col++, src++, dst += CHAR_W)
+		{
+			const Cell cell = *src;
+			const int attributes = CellAttributes(cell);
+			const byte* pixels = GetGlyph(CellGlyph(cell), attributes & CELL_ATTR_TRANSFORM);
+			int forecolor = Palette[CellForeground(cell)];
+			int backcolor = Palette[CellBackground(cell)];
+
+			if (attributes & CELL_ATTR_REVERSE)
+				std::swap(forecolor, backcolor);
+
+			const int diff = forecolor ^ backcolor;
+			int* line = dst;
+
+			for (int i = 0; i < CHAR_H; i++, line += SCREEN_W)
+			{
+				const unsigned int bits = pixels[i];
+
+				for (int pos = 0; pos < CHAR_W; pos++)
+					line[pos] = backcolor ^ (diff & -(int)((bits >> (CHAR_W - 1 - pos)) & 1));
+			}
+		}
+	}
+
+	TRACE_END("DrawCellBlock");
+	PROFILE_END(Profiler, PHASE_DRAW);
+}
+
+void Graphics::DrawChar(int chr, int x, int y, int forecolor, int backcolor, int transform)
+{
+	PROFILE_BEGIN(PHASE_DRAW);
+	TRACE_BEGIN("DrawChar");
+	DrawGlyph<CHAR_H>(GetGlyph(chr, transform), x, y, forecolor, backcolor, CHAR_H);
+	TRACE_END("DrawChar");
+	PROFILE_END(Profiler, PHASE_DRAW);
+}
+
+void Graphics::PutChar(const Font& font, int chr, int x, int y, int forecolor, int backcolor)
+{
+	DrawChar(font, chr, x * CHAR_W, y * font.Height, forecolor, backcolor);
+}
+
+void Graphics::DrawChar(const Font& font, int chr, int x, int y, int forecolor, int backcolor)
+{
+	PROFILE_BEGIN(PHASE_DRAW);
+	TRACE_BEGIN("DrawChar");
+	const byte* pixels = font.GetGlyph(chr);
+
+	// Common console heights get their own unrolled row loop
+	switch (font.Height)
+	{
+		case 8:
+			DrawGlyph<8>(pixels, x, y, forecolor, backcolor, 8);
+			break;
+		case 14:
+			DrawGlyph<14>(pixels, x, y, forecolor, backcolor, 14);
+			break;
+		case 16:
+			DrawGlyph<16>(pixels, x, y, forecolor, backcolor, 16);
+			break;
+		default:
+			DrawGlyph<0>(pixels, x, y, forecolor, backcolor, font.Height);
+			break;
+	}
+
+	TRACE_END("DrawChar");
+	PROFILE_END(Profiler, PHASE_DRAW);
+}
+
+// H is the glyph height when known at compile time, or 0 to use height
+template <int H>
+void Graphics::DrawGlyph(const byte* pixels, int x, int y, int forecolor, int backcolor, int height)
+{
+	const int rows = H ? H : height;
+	Damage(x, y, CHAR_W, rows);
+
+	if (DrawsMono())
+	{
+		DrawCharMono(pixels, rows, x, y, forecolor, backcolor);
+		return;
+	}
+
+	const SDL_Rect& clip = Target.Clip;
+
+	// Opaque glyphs fully inside the target skip the per-pixel clip test
+	if (Mode == DRAW_COPY && x >= clip.x && y >= clip.y && x + CHAR_W <= clip.x + clip.w && y + rows <= clip.y + clip.h)
+	{
+		const int diff = forecolor ^ backcolor;
+		int* line = Target.Pixels + (size_t)y * Target.Pitch + x;
+
+		for (int i = 0; i < rows; i++, line += Target.Pitch)
+		{
+			const unsigned int bits = pixels[i];
+
+			for (int pos = 0; pos < CHAR_W; pos++)
+				line[pos] = backcolor ^ (diff & -(int)((bits >> (CHAR_W - 1 - pos)) & 1));
+		}
+		return;
+	}
 
 	const int initialX = x;
 
-	for (int i = 0; i < CHAR_H; i++)
+	for (int i = 0; i < rows; i++)
 	{
 		const unsigned int& bits = pixels[i];
 
 		for (int pos = CHAR_W - 1; pos >= 0; pos--, x++)
-			SetPixel(x, y, (bits & (1 << pos)) ? forecolor : backcolor);
+		{
+			const bool set = (bits & (1 << pos)) != 0;
+
+			if (Mode == DRAW_COPY)
+				SetPixel(x, y, set ? forecolor : backcolor);
+			else if (!set)
+				continue;
+			else if (Mode == DRAW_OR)
+				SetPixel(x, y, forecolor);
+			else if (x >= clip.x && y >= clip.y && x < clip.x + clip.w && y < clip.y + clip.h)
+				Target.Pixels[(size_t)y * Target.Pitch + x] ^= forecolor;
+		}
 
 		y++;
 		x = initialX;
 	}
 }
 
+void Graphics::DrawCharMono(const byte* pixels, int height, int x, int y, int forecolor, int backcolor)
+{
+	if (x <= -CHAR_W || y <= -height || x >= SCREEN_W || y >= SCREEN_H)
+		return;
+
+	const byte foreMask = forecolor != MonoBackColor ? 0xff : 0x00;
+	const byte backMask = backcolor != MonoBackColor ? 0xff : 0x00;
+
+	for (int i = 0; i < height; i++, y++)
+	{
+		if (y < 0 || y >= SCREEN_H)
+			continue;
+
+		const byte bits = pixels[i];
+
+		if (Mode == DRAW_COPY)
+			WriteMonoRow(y, x, (bits & foreMask) | (~bits & backMask), 0xff, 0);
+		else if (Mode == DRAW_OR)
+			WriteMonoRow(y, x, bits & foreMask, bits & ~foreMask, 0);
+		else
+			WriteMonoRow(y, x, 0, 0, bits);
+	}
+}
+
+void Graphics::WriteMonoRow(int y, int x, byte set, byte clear, byte toggle)
+{
+	byte* row = MonoBuffer[y];
+	const int col = x >> 3;
+	const int shift = x & 7;
+
+	if (shift == 0)
+	{
+		row[col] = ((row[col] & ~clear) | set) ^ toggle;
+		return;
+	}
+
+	if (col >= 0)
+		row[col] = ((row[col] & ~(clear >> shift)) | (set >> shift)) ^ (toggle >> shift);
+
+	if (col + 1 < MONO_PITCH)
+	{
+		const int rshift = 8 - shift;
+		row[col + 1] = ((row[col + 1] & ~(byte)(clear << rshift)) | (byte)(set << rshift)) ^ (byte)(toggle << rshift);
+	}
+}
+
+void Graphics::ReadPixels(Uint32* pixels, int pitch)
+{
+	if (Monochrome)
+	{
+		UploadMono(pixels, pitch);
+		return;
+	}
+
+	for (int y = 0; y < SCREEN_H; y++)
+		SDL_memcpy((byte*)pixels + y * pitch, Buffer[y], SCREEN_W * sizeof(int));
+}
+
+void Graphics::UploadMono(Uint32* pixels, int pitch)
+{
+	const Uint32 back = MonoBackColor;
+	const Uint32 diff = MonoForeColor ^ MonoBackColor;
+
+	for (int y = 0; y < SCREEN_H; y++)
+	{
+		const byte* src = MonoBuffer[y];
+		Uint32* dst = (Uint32*)((byte*)pixels + y * pitch);
+
+		for (int col = 0; col < MONO_PITCH; col++, dst += 8)
+		{
+			const unsigned int bits = src[col];
+
+			for (int pos = 0; pos < 8; pos++)
+				dst[pos] = back ^ (diff & (0 - ((bits >> (7 - pos)) & 1)));
+		}
+	}
+}
+
+void Graphics::SetMonochrome(bool enabled, int forecolor, int backcolor)
+{
+	if (enabled && !Monochrome)
+	{
+		for (int y = 0; y < SCREEN_H; y++)
+		{
+			for (int col = 0; col < MONO_PITCH; col++)
+			{
+				byte bits = 0;
+				for (int pos = 0; pos < 8; pos++)
+					bits = (bits << 1) | (Buffer[y][col * 8 + pos] != backcolor ? 1 : 0);
+				MonoBuffer[y][col] = bits;
+			}
+		}
+	}
+	else if (!enabled && Monochrome)
+	{
+		for (int y = 0; y < SCREEN_H; y++)
+			for (int x = 0; x < SCREEN_W; x++)
+				Buffer[y][x] = (MonoBuffer[y][x >> 3] & (0x80 >> (x & 7))) ? MonoForeColor : MonoBackColor;
+	}
+
+	// Snapshot tiles are stored in the format of the buffer they came from
+	if (enabled != Monochrome)
+	{
+		Snapshots.Clear();
+		LastFrameValid = false;
+	}
+
+	Monochrome = enabled;
+	MonoForeColor = forecolor;
+	MonoBackColor = backcolor;
+}
+
+bool Graphics::IsMonochrome()
+{
+	return Monochrome;
+}
+
+void Graphics::SetDrawMode(DrawMode mode)
+{
+	Mode = mode;
+}
+
+void Graphics::SetLatencyProbe(LatencyProbe* probe)
+{
+	Probe = probe;
+}
+
+void Graphics::SetAssetLoader(AssetLoader* loader)
+{
+	Loader = loader;
+}
+
+void Graphics::SetScheduler(Scheduler* scheduler)
+{
+	Tasks = scheduler;
+}
+
+void Graphics::PushScreen()
+{
+	if (Monochrome)
+		Snapshots.Push((Uint8*)MonoBuffer, MONO_PITCH, CHAR_W / 8, CHAR_H, COLS, ROWS);
+	else
+		Snapshots.Push((Uint8*)Buffer, SCREEN_W * sizeof(int), CHAR_W * sizeof(int), CHAR_H, COLS, ROWS);
+}
+
+bool Graphics::PopScreen()
+{
+	return Snapshots.Pop();
+}
+
+#ifdef GRAPHICS_PROFILE
+void Graphics::GetFrameStats(FrameStats& stats)
+{
+	Profiler.GetStats(stats);
+}
+
+void Graphics::SetFrameTimingCallback(FrameTimingCallback callback)
+{
+	Profiler.SetCallback(callback);
+}
+#endif
+
 void Graphics::Print(int x, int y, int forecolor, int backcolor, const char* fmt, ...)
 {
 	char str[FMT_TO_STR_MAXLEN] = { 0 };
@@ -136,7 +883,7 @@ void Graphics::Print(int x, int y, int forecolor, int backcolor, const char* fmt
 
 	while (true)
 	{
-		int chr = str[i++];
+		int chr = (byte)str[i++];
 		if (chr == '\0')
 			break;
 
@@ -144,6 +891,592 @@ void Graphics::Print(int x, int y, int forecolor, int backcolor, const char* fmt
 	}
 }
 
+void Graphics::PrintUtf8(int x, int y, int forecolor, int backcolor, const char* fmt, ...)
+{
+	char str[FMT_TO_STR_MAXLEN] = { 0 };
+	va_list arg;
+	va_start(arg, fmt);
+	vsprintf_s(str, fmt, arg);
+	va_end(arg);
+
+	Uint16 glyphs[FMT_TO_STR_MAXLEN];
+	const int count = Codepoints.Decode(str, SDL_strlen(str), glyphs, FMT_TO_STR_MAXLEN);
+
+	for (int i = 0; i < count; i++)
+		PutChar(glyphs[i], x++, y, forecolor, backcolor);
+}
+
+void Graphics::FillSpan(int x1, int x2, int y, int color)
+{
+	const SDL_Rect& clip = Target.Clip;
+
+	if (y < clip.y || y >= clip.y + clip.h)
+		return;
+	if (x1 < clip.x)
+		x1 = clip.x;
+	if (x2 >= clip.x + clip.w)
+		x2 = clip.x + clip.w - 1;
+	if (x1 > x2)
+		return;
+
+	Damage(x1, y, x2 - x1 + 1, 1);
+
+	if (DrawsMono())
+	{
+		byte* row = MonoBuffer[y];
+		const int col1 = x1 >> 3;
+		const int col2 = x2 >> 3;
+		const byte first = 0xff >> (x1 & 7);
+		const byte last = 0xff << (7 - (x2 & 7));
+		const bool on = color != MonoBackColor;
+
+		if (col1 == col2)
+		{
+			const byte mask = first & last;
+			if (Mode == DRAW_XOR)
+				row[col1] ^= mask;
+			else
+				row[col1] = on ? row[col1] | mask : row[col1] & ~mask;
+			return;
+		}
+
+		if (Mode == DRAW_XOR)
+		{
+			row[col1] ^= first;
+			for (int col = col1 + 1; col < col2; col++)
+				row[col] ^= 0xff;
+			row[col2] ^= last;
+		}
+		else
+		{
+			row[col1] = on ? row[col1] | first : row[col1] & ~first;
+			SDL_memset(row + col1 + 1, on ? 0xff : 0x00, col2 - col1 - 1);
+			row[col2] = on ? row[col2] | last : row[col2] & ~last;
+		}
+		return;
+	}
+
+	int* pixels = Target.Pixels + (size_t)y * Target.Pitch + x1;
+	const int count = x2 - x1 + 1;
+
+	if (Mode == DRAW_XOR)
+	{
+		for (int i = 0; i < count; i++)
+			pixels[i] ^= color;
+	}
+	else
+	{
+		SDL_memset4(pixels, color, count);
+	}
+}
+
+void Graphics::PlotClipped(int x, int y, int color)
+{
+	const SDL_Rect& clip = Target.Clip;
+
+	if (x >= clip.x && y >= clip.y && x < clip.x + clip.w && y < clip.y + clip.h)
+		FillSpan(x, x, y, color);
+}
+
+enum ClipCode
+{
+	CLIP_LEFT = 1,
+	CLIP_RIGHT = 2,
+	CLIP_TOP = 4,
+	CLIP_BOTTOM = 8
+};
+
+static int GetClipCode(int x, int y, const SDL_Rect& clip)
+{
+	int code = 0;
+
+	if (x < clip.x)
+		code |= CLIP_LEFT;
+	else if (x >= clip.x + clip.w)
+		code |= CLIP_RIGHT;
+	if (y < clip.y)
+		code |= CLIP_TOP;
+	else if (y >= clip.y + clip.h)
+		code |= CLIP_BOTTOM;
+
+	return code;
+}
+
+// a * b / c rounded toward zero; the product of two 33-bit magnitudes
+// still fits in 64 unsigned bits
+static Sint64 MulDiv(Sint64 a, Sint64 b, Sint64 c)
+{
+	const bool negative = (a < 0) != (b < 0) != (c < 0);
+	const Uint64 quotient = (Uint64)(a < 0 ? -a : a) * (Uint64)(b < 0 ? -b : b) / (Uint64)(c < 0 ? -c : c);
+	return negative ? -(Sint64)quotient : (Sint64)quotient;
+}
+
+static bool ClipLine(int& x1, int& y1, int& x2, int& y2, const SDL_Rect& clip)
+{
+	int code1 = GetClipCode(x1, y1, clip);
+	int code2 = GetClipCode(x2, y2, clip);
+
+	while (true)
+	{
+		if (!(code1 | code2))
+			return true;
+		if (code1 & code2)
+			return false;
+
+		const int code = code1 ? code1 : code2;
+		const Sint64 dx = (Sint64)x2 - x1;
+		const Sint64 dy = (Sint64)y2 - y1;
+		int x, y;
+
+		if (code & CLIP_TOP)
+		{
+			y = clip.y;
+			x = (int)(x1 + MulDiv(dx, (Sint64)y - y1, dy));
+		}
+		else if (code & CLIP_BOTTOM)
+		{
+			y = clip.y + clip.h - 1;
+			x = (int)(x1 + MulDiv(dx, (Sint64)y - y1, dy));
+		}
+		else if (code & CLIP_LEFT)
+		{
+			x = clip.x;
+			y = (int)(y1 + MulDiv(dy, (Sint64)x - x1, dx));
+		}
+		else
+		{
+			x = clip.x + clip.w - 1;
+			y = (int)(y1 + MulDiv(dy, (Sint64)x - x1, dx));
+		}
+
+		if (code == code1)
+		{
+			x1 = x;
+			y1 = y;
+			code1 = GetClipCode(x1, y1, clip);
+		}
+		else
+		{
+			x2 = x;
+			y2 = y;
+			code2 = GetClipCode(x2, y2, clip);
+		}
+	}
+}
+
+void Graphics::DrawLine(int x1, int y1, int x2, int y2, int color)
+{
+	if (!ClipLine(x1, y1, x2, y2, Target.Clip))
+		return;
+
+	if (y1 == y2)
+	{
+		FillSpan(SDL_min(x1, x2), SDL_max(x1, x2), y1, color);
+		return;
+	}
+
+	const int dx = SDL_abs(x2 - x1);
+	const int dy = SDL_abs(y2 - y1);
+	const int sx = x1 < x2 ? 1 : -1;
+	const int sy = y1 < y2 ? 1 : -1;
+
+	if (dx > dy)
+	{
+		// X-major: collect each row's run of pixels into one span
+		int err = dx / 2;
+		int runStart = x1;
+
+		for (int x = x1; ; x += sx)
+		{
+			const bool last = x == x2;
+			err -= dy;
+
+			if (last || err < 0)
+			{
+				FillSpan(SDL_min(runStart, x), SDL_max(runStart, x), y1, color);
+				if (last)
+					break;
+				y1 += sy;
+				err += dx;
+				runStart = x + sx;
+			}
+		}
+	}
+	else
+	{
+		int err = dy / 2;
+
+		for (int y = y1; ; y += sy)
+		{
+			FillSpan(x1, x1, y, color);
+			if (y == y2)
+				break;
+			err -= dx;
+			if (err < 0)
+			{
+				x1 += sx;
+				err += dy;
+			}
+		}
+	}
+}
+
+void Graphics::DrawRect(int x, int y, int w, int h, int color)
+{
+	if (w <= 0 || h <= 0)
+		return;
+
+	FillSpan(x, x + w - 1, y, color);
+	if (h > 1)
+		FillSpan(x, x + w - 1, y + h - 1, color);
+
+	for (int row = y + 1; row < y + h - 1; row++)
+	{
+		PlotClipped(x, row, color);
+		if (w > 1)
+			PlotClipped(x + w - 1, row, color);
+	}
+}
+
+void Graphics::FillRect(int x, int y, int w, int h, int color)
+{
+	const int y1 = SDL_max(y, Target.Clip.y);
+	const int y2 = SDL_min(y + h, Target.Clip.y + Target.Clip.h);
+
+	for (int row = y1; row < y2; row++)
+		FillSpan(x, x + w - 1, row, color);
+}
+
+void Graphics::DrawCircle(int cx, int cy, int radius, int color)
+{
+	DrawEllipse(cx, cy, radius, radius, color);
+}
+
+void Graphics::FillCircle(int cx, int cy, int radius, int color)
+{
+	FillEllipse(cx, cy, radius, radius, color);
+}
+
+void Graphics::DrawEllipse(int cx, int cy, int rx, int ry, int color)
+{
+	RasterizeEllipse(cx, cy, rx, ry, color, false);
+}
+
+void Graphics::FillEllipse(int cx, int cy, int rx, int ry, int color)
+{
+	RasterizeEllipse(cx, cy, rx, ry, color, true);
+}
+
+void Graphics::EllipseRows(int cx, int cy, int x, int y, int color, bool filled)
+{
+	if (filled)
+	{
+		FillSpan(cx - x, cx + x, cy + y, color);
+		if (y != 0)
+			FillSpan(cx - x, cx + x, cy - y, color);
+		return;
+	}
+
+	PlotClipped(cx + x, cy + y, color);
+	if (x != 0)
+		PlotClipped(cx - x, cy + y, color);
+	if (y != 0)
+	{
+		PlotClipped(cx + x, cy - y, color);
+		if (x != 0)
+			PlotClipped(cx - x, cy - y, color);
+	}
+}
+
+void Graphics::RasterizeEllipse(int cx, int cy, int rx, int ry, int color, bool filled)
+{
+	if (rx < 0 || ry < 0)
+		return;
+	const SDL_Rect& clip = Target.Clip;
+	if (cx + rx < clip.x || cx - rx >= clip.x + clip.w || cy + ry < clip.y || cy - ry >= clip.y + clip.h)
+		return;
+
+	if (ry == 0)
+	{
+		FillSpan(cx - rx, cx + rx, cy, color);
+		return;
+	}
+	if (rx == 0)
+	{
+		for (int y = cy - ry; y <= cy + ry; y++)
+			PlotClipped(cx, y, color);
+		return;
+	}
+
+	const Sint64 rx2 = (Sint64)rx * rx;
+	const Sint64 ry2 = (Sint64)ry * ry;
+	Sint64 x = 0;
+	Sint64 y = ry;
+	Sint64 dx = 0;
+	Sint64 dy = 2 * rx2 * y;
+
+	// Region 1 steps in x; a filled row is emitted only as y is about to
+	// change, so every row gets exactly one span
+	Sint64 d1 = ry2 - rx2 * ry + rx2 / 4;
+	while (dx < dy)
+	{
+		if (!filled)
+			EllipseRows(cx, cy, (int)x, (int)y, color, false);
+
+		if (d1 < 0)
+		{
+			x++;
+			dx += 2 * ry2;
+			d1 += dx + ry2;
+		}
+		else
+		{
+			if (filled)
+				EllipseRows(cx, cy, (int)x, (int)y, color, true);
+			x++;
+			y--;
+			dx += 2 * ry2;
+			dy -= 2 * rx2;
+			d1 += dx - dy + ry2;
+		}
+	}
+
+	// Region 2 steps in y
+	Sint64 d2 = ry2 * (x * x + x) + ry2 / 4 + rx2 * (y - 1) * (y - 1) - rx2 * ry2;
+	while (y >= 0)
+	{
+		EllipseRows(cx, cy, (int)x, (int)y, color, filled);
+		y--;
+		dy -= 2 * rx2;
+
+		if (d2 > 0)
+		{
+			d2 += rx2 - dy;
+		}
+		else
+		{
+			x++;
+			dx += 2 * ry2;
+			d2 += dx - dy + rx2;
+		}
+	}
+}
+
+void Graphics::DrawPolygon(const SDL_Point* points, int count, int color)
+{
+	for (int i = 0; i < count; i++)
+	{
+		const SDL_Point& a = points[i];
+		const SDL_Point& b = points[(i + 1) % count];
+		DrawLine(a.x, a.y, b.x, b.y, color);
+	}
+}
+
+struct PolygonEdge
+{
+	int YMin;
+	int YMax;
+	Sint64 X;
+	Sint64 Step;
+};
+
+static bool CompareEdgeY(const PolygonEdge& a, const PolygonEdge& b)
+{
+	return a.YMin < b.YMin;
+}
+
+static bool CompareEdgeX(const PolygonEdge* a, const PolygonEdge* b)
+{
+	return a->X < b->X;
+}
+
+void Graphics::FillPolygon(const SDL_Point* points, int count, int color)
+{
+	static thread_local std::vector<PolygonEdge> edges;
+	static thread_local std::vector<PolygonEdge*> active;
+
+	if (count < 3)
+		return;
+
+	// Edges sample pixel centres, in 32.32 fixed point
+	edges.clear();
+	for (int i = 0; i < count; i++)
+	{
+		SDL_Point a = points[i];
+		SDL_Point b = points[(i + 1) % count];
+
+		if (a.y == b.y)
+			continue;
+		if (a.y > b.y)
+			std::swap(a, b);
+
+		PolygonEdge edge;
+		edge.YMin = a.y;
+		edge.YMax = b.y;
+		edge.Step = ((Sint64)(b.x - a.x) << 32) / (b.y - a.y);
+		edge.X = ((Sint64)a.x << 32) + edge.Step / 2;
+		edges.push_back(edge);
+	}
+
+	if (edges.empty())
+		return;
+
+	std::sort(edges.begin(), edges.end(), CompareEdgeY);
+
+	active.clear();
+	size_t next = 0;
+	int y = edges[0].YMin;
+
+	const int top = Target.Clip.y;
+	const int bottom = Target.Clip.y + Target.Clip.h;
+
+	// Rows above the target only move the edges along, so step every edge
+	// that reaches the top row there directly
+	if (y < top)
+	{
+		while (next < edges.size() && edges[next].YMin < top)
+		{
+			PolygonEdge& edge = edges[next++];
+
+			if (edge.YMax > top)
+			{
+				edge.X += edge.Step * ((Sint64)top - edge.YMin);
+				active.push_back(&edge);
+			}
+		}
+
+		y = top;
+	}
+
+	while (y < bottom && (next < edges.size() || !active.empty()))
+	{
+		if (active.empty() && edges[next].YMin > y)
+			y = edges[next].YMin;
+
+		while (next < edges.size() && edges[next].YMin == y)
+			active.push_back(&edges[next++]);
+
+		size_t kept = 0;
+		for (size_t i = 0; i < active.size(); i++)
+			if (active[i]->YMax > y)
+				active[kept++] = active[i];
+		active.resize(kept);
+
+		std::sort(active.begin(), active.end(), CompareEdgeX);
+
+		for (size_t i = 0; i + 1 < active.size(); i += 2)
+		{
+			const int x1 = (int)((active[i]->X + 0x7fffffffLL) >> 32);
+			const int x2 = (int)((active[i + 1]->X + 0x7fffffffLL) >> 32) - 1;
+			FillSpan(x1, x2, y, color);
+		}
+
+		for (size_t i = 0; i < active.size(); i++)
+			active[i]->X += active[i]->Step;
+
+		y++;
+	}
+}
+
+void Graphics::BlitImage(const Uint32* pixels, int w, int h, int pitch, int x, int y, BlendMode mode, Uint32 colorkey)
+{
+	const SDL_Rect& clip = Target.Clip;
+	int srcX = 0;
+	int srcY = 0;
+
+	if (x < clip.x)
+	{
+		srcX = clip.x - x;
+		w -= srcX;
+		x = clip.x;
+	}
+	if (y < clip.y)
+	{
+		srcY = clip.y - y;
+		h -= srcY;
+		y = clip.y;
+	}
+	if (x + w > clip.x + clip.w)
+		w = clip.x + clip.w - x;
+	if (y + h > clip.y + clip.h)
+		h = clip.y + clip.h - y;
+	if (w <= 0 || h <= 0)
+		return;
+
+	Damage(x, y, w, h);
+
+	for (int row = 0; row < h; row++)
+	{
+		const Uint32* src = (const Uint32*)((const byte*)pixels + (srcY + row) * pitch) + srcX;
+
+		if (!DrawsMono())
+		{
+			BlendRow((Uint32*)(Target.Pixels + (size_t)(y + row) * Target.Pitch + x), src, w, mode, colorkey);
+			continue;
+		}
+
+		// Monochrome targets take a pixel when it is mostly opaque
+		for (int col = 0; col < w; col++)
+		{
+			const Uint32 pixel = src[col];
+			const bool visible = mode == BLEND_COLORKEY ?
+				(pixel & 0xffffff) != (colorkey & 0xffffff) : (pixel >> 24) >= 128;
+
+			if (visible)
+				FillSpan(x + col, x + col, y + row, pixel & 0xffffff);
+		}
+	}
+}
+
+void Graphics::DrawCanvas(const Canvas& canvas, int x, int y)
+{
+	// Keyed or translucent compositing goes through BlitImage instead
+	int srcX = 0;
+	int srcY = 0;
+	int w = canvas.Width();
+	int h = canvas.Height();
+
+	if (x < 0)
+	{
+		srcX = -x;
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		srcY = -y;
+		h += y;
+		y = 0;
+	}
+	if (x + w > SCREEN_W)
+		w = SCREEN_W - x;
+	if (y + h > SCREEN_H)
+		h = SCREEN_H - y;
+	if (w <= 0 || h <= 0)
+		return;
+
+	PROFILE_BEGIN(PHASE_DRAW);
+	TRACE_BEGIN("DrawCanvas");
+	Damage(x, y, w, h);
+
+	for (int row = 0; row < h; row++)
+	{
+		const int* src = canvas.Pixels() + (size_t)(srcY + row) * canvas.Width() + srcX;
+
+		if (!Monochrome)
+		{
+			SDL_memcpy(&Buffer[y + row][x], src, w * sizeof(int));
+			continue;
+		}
+
+		for (int col = 0; col < w; col++)
+			SetPixel(x + col, y + row, src[col]);
+	}
+
+	TRACE_END("DrawCanvas");
+	PROFILE_END(Profiler, PHASE_DRAW);
+}
+
 void Graphics::SaveCharset(const char* filename)
 {
 	FILE* fp = fopen(filename, "wb");
@@ -159,266 +1492,156 @@ void Graphics::LoadCharset(const char* filename)
 
 	fread(Charset, sizeof(Charset), 1, fp);
 	fclose(fp);
+
+	InvalidateGlyphCache();
+}
+
+struct StateFields
+{
+	Uint32 Monochrome;
+	Uint32 MonoForeColor;
+	Uint32 MonoBackColor;
+	Uint32 Mode;
+};
+
+static const size_t StateRawSize = sizeof(Graphics::Buffer) + sizeof(Graphics::MonoBuffer) +
+	sizeof(Graphics::Charset) + sizeof(Graphics::Palette) + sizeof(StateFields);
+
+void Graphics::SaveState(std::vector<Uint8>& blob, bool compress)
+{
+	TRACE_SCOPE("SaveState");
+	static thread_local std::vector<Uint8> raw;
+	raw.resize(StateRawSize);
+
+	StateFields fields;
+	fields.Monochrome = Monochrome;
+	fields.MonoForeColor = MonoForeColor;
+	fields.MonoBackColor = MonoBackColor;
+	fields.Mode = Mode;
+
+	Uint8* p = raw.data();
+	SDL_memcpy(p, Buffer, sizeof(Buffer));
+	p += sizeof(Buffer);
+	SDL_memcpy(p, MonoBuffer, sizeof(MonoBuffer));
+	p += sizeof(MonoBuffer);
+	SDL_memcpy(p, Charset, sizeof(Charset));
+	p += sizeof(Charset);
+	SDL_memcpy(p, Palette, sizeof(Palette));
+	p += sizeof(Palette);
+	SDL_memcpy(p, &fields, sizeof(fields));
+
+	GraphicsStateHeader header;
+	header.Magic = STATE_MAGIC;
+	header.Version = STATE_VERSION;
+	header.Flags = 0;
+	header.RawSize = StateRawSize;
+	header.Hash = HashBytes(raw.data(), raw.size());
+
+	const std::vector<Uint8>* payload = &raw;
+	static thread_local std::vector<Uint8> packed;
+
+	if (compress)
+	{
+		CompressBlock(raw.data(), raw.size(), packed);
+		header.Flags |= STATE_COMPRESSED;
+		payload = &packed;
+	}
+
+	header.PayloadSize = (Uint32)payload->size();
+	blob.resize(sizeof(header) + payload->size());
+	SDL_memcpy(blob.data(), &header, sizeof(header));
+	SDL_memcpy(blob.data() + sizeof(header), payload->data(), payload->size());
+}
+
+bool Graphics::LoadState(const void* blob, size_t size)
+{
+	TRACE_SCOPE("LoadState");
+
+	GraphicsStateHeader header;
+	if (size < sizeof(header))
+		return false;
+
+	SDL_memcpy(&header, blob, sizeof(header));
+	if (header.Magic != STATE_MAGIC || header.Version != STATE_VERSION ||
+		header.RawSize != StateRawSize || header.PayloadSize != size - sizeof(header))
+		return false;
+
+	const Uint8* payload = (const Uint8*)blob + sizeof(header);
+	static thread_local std::vector<Uint8> raw;
+
+	if (header.Flags & STATE_COMPRESSED)
+	{
+		raw.resize(StateRawSize);
+		if (!DecompressBlock(payload, header.PayloadSize, raw.data(), raw.size()))
+			return false;
+		payload = raw.data();
+	}
+	else if (header.PayloadSize != StateRawSize)
+	{
+		return false;
+	}
+
+	// Nothing is touched until the whole payload is known to be intact
+	if (HashBytes(payload, StateRawSize) != header.Hash)
+		return false;
+
+	StateFields fields;
+	SDL_memcpy(&fields, payload + StateRawSize - sizeof(fields), sizeof(fields));
+	if (fields.Mode > DRAW_XOR)
+		return false;
+
+	if ((fields.Monochrome != 0) != Monochrome)
+		Snapshots.Clear();
+	else
+		Damage(0, 0, SCREEN_W, SCREEN_H);
+
+	SDL_memcpy(Buffer, payload, sizeof(Buffer));
+	payload += sizeof(Buffer);
+	SDL_memcpy(MonoBuffer, payload, sizeof(MonoBuffer));
+	payload += sizeof(MonoBuffer);
+	SDL_memcpy(Charset, payload, sizeof(Charset));
+	payload += sizeof(Charset);
+	SDL_memcpy(Palette, payload, sizeof(Palette));
+
+	Monochrome = fields.Monochrome != 0;
+	MonoForeColor = fields.MonoForeColor;
+	MonoBackColor = fields.MonoBackColor;
+	Mode = (DrawMode)fields.Mode;
+
+	InvalidateGlyphCache();
+	LastFrameValid = false;
+	return true;
 }
 
 void Graphics::SetupDefaultCharset()
 {
+	SDL_memcpy(Charset, DefaultCharset, 256 * CHAR_H);
+	InvalidateGlyphCache();
+}
+
+void Graphics::SetupDefaultPalette()
+{
+	// The xterm 256-colour layout: 16 ANSI colours, a 6x6x6 cube, 24 greys
+	static const int ansi[16] =
+	{
+		0x000000, 0xaa0000, 0x00aa00, 0xaa5500, 0x0000aa, 0xaa00aa, 0x00aaaa, 0xaaaaaa,
+		0x555555, 0xff5555, 0x55ff55, 0xffff55, 0x5555ff, 0xff55ff, 0x55ffff, 0xffffff
+	};
+	static const int levels[6] = { 0x00, 0x5f, 0x87, 0xaf, 0xd7, 0xff };
+
 	int i = 0;
 
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x7e, 0x81, 0xa5, 0x81, 0xbd, 0x99, 0x81, 0x7e);
-	SetChar(i++, 0x7e, 0xff, 0xdb, 0xff, 0xc3, 0xe7, 0xff, 0x7e);
-	SetChar(i++, 0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00);
-	SetChar(i++, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x00);
-	SetChar(i++, 0x38, 0x7c, 0x38, 0xfe, 0xfe, 0xd6, 0x10, 0x38);
-	SetChar(i++, 0x10, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x10, 0x38);
-	SetChar(i++, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00);
-	SetChar(i++, 0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff);
-	SetChar(i++, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00);
-	SetChar(i++, 0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff);
-	SetChar(i++, 0x0f, 0x07, 0x0f, 0x7d, 0xcc, 0xcc, 0xcc, 0x78);
-	SetChar(i++, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18);
-	SetChar(i++, 0x3f, 0x33, 0x3f, 0x30, 0x30, 0x30, 0xf0, 0xf0);
-	SetChar(i++, 0x7f, 0x63, 0x7f, 0x63, 0x63, 0x67, 0xe7, 0xe0);
-	SetChar(i++, 0x99, 0x5a, 0x3c, 0xe7, 0xe7, 0x3c, 0x5a, 0x99);
-	SetChar(i++, 0x80, 0xe0, 0xf8, 0xfe, 0xf8, 0xe0, 0x80, 0x00);
-	SetChar(i++, 0x01, 0x07, 0x1f, 0x7f, 0x1f, 0x07, 0x01, 0x00);
-	SetChar(i++, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c, 0x18);
-	SetChar(i++, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x00);
-	SetChar(i++, 0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00);
-	SetChar(i++, 0x7e, 0xc3, 0x78, 0xcc, 0xcc, 0x78, 0x8c, 0xf8);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00);
-	SetChar(i++, 0x18, 0x3c, 0x7e, 0x18, 0x7e, 0x3c, 0x18, 0xff);
-	SetChar(i++, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00);
-	SetChar(i++, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00);
-	SetChar(i++, 0x00, 0x18, 0x0c, 0xfe, 0x0c, 0x18, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x30, 0x60, 0xfe, 0x60, 0x30, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xfe, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x24, 0x66, 0xff, 0x66, 0x24, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x00, 0x00);
-	SetChar(i++, 0x00, 0xff, 0xff, 0x7e, 0x3c, 0x18, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x3c, 0x3c, 0x18, 0x18, 0x00, 0x18, 0x00);
-	SetChar(i++, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x00);
-	SetChar(i++, 0x18, 0x3e, 0x60, 0x3c, 0x06, 0x7c, 0x18, 0x00);
-	SetChar(i++, 0x00, 0xc6, 0xcc, 0x18, 0x30, 0x66, 0xc6, 0x00);
-	SetChar(i++, 0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc, 0x76, 0x00);
-	SetChar(i++, 0x70, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x30, 0x60, 0x60, 0x60, 0x30, 0x18, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00);
-	SetChar(i++, 0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x60);
-	SetChar(i++, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00);
-	SetChar(i++, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x00);
-	SetChar(i++, 0x78, 0xcc, 0xdc, 0xfc, 0xec, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0x30, 0xf0, 0x30, 0x30, 0x30, 0x30, 0xfc, 0x00);
-	SetChar(i++, 0x78, 0xcc, 0x0c, 0x38, 0x60, 0xcc, 0xfc, 0x00);
-	SetChar(i++, 0x78, 0xcc, 0x0c, 0x78, 0x0c, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0x0c, 0x0c, 0x00);
-	SetChar(i++, 0xfc, 0xc0, 0xf8, 0x0c, 0x0c, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0x38, 0x60, 0xc0, 0xf8, 0xcc, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0xfc, 0xcc, 0x0c, 0x18, 0x30, 0x60, 0x60, 0x00);
-	SetChar(i++, 0x78, 0xcc, 0xcc, 0x78, 0xcc, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0x78, 0xcc, 0xcc, 0x7c, 0x0c, 0x18, 0x70, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x30, 0x30, 0x00, 0x70, 0x30, 0x60);
-	SetChar(i++, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 0x00);
-	SetChar(i++, 0x78, 0xcc, 0x0c, 0x18, 0x30, 0x00, 0x30, 0x00);
-	SetChar(i++, 0x7c, 0xc6, 0xde, 0xd6, 0xde, 0xc0, 0x78, 0x00);
-	SetChar(i++, 0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x00);
-	SetChar(i++, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00);
-	SetChar(i++, 0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x66, 0x3c, 0x00);
-	SetChar(i++, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00);
-	SetChar(i++, 0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe, 0x00);
-	SetChar(i++, 0xfe, 0x62, 0x68, 0x78, 0x68, 0x60, 0xf0, 0x00);
-	SetChar(i++, 0x3c, 0x66, 0xc0, 0xc0, 0xce, 0x66, 0x3e, 0x00);
-	SetChar(i++, 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x00);
-	SetChar(i++, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x1e, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x00);
-	SetChar(i++, 0xf0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00);
-	SetChar(i++, 0xc6, 0xee, 0xfe, 0xd6, 0xc6, 0xc6, 0xc6, 0x00);
-	SetChar(i++, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00);
-	SetChar(i++, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00);
-	SetChar(i++, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00);
-	SetChar(i++, 0x38, 0x6c, 0xc6, 0xc6, 0xce, 0x6c, 0x3e, 0x00);
-	SetChar(i++, 0xfc, 0x66, 0x66, 0x7c, 0x78, 0x6c, 0xe6, 0x00);
-	SetChar(i++, 0x7c, 0xc6, 0xc0, 0x7c, 0x06, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0xfe, 0xba, 0x38, 0x38, 0x38, 0x38, 0x7c, 0x00);
-	SetChar(i++, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00);
-	SetChar(i++, 0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00);
-	SetChar(i++, 0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6, 0x00);
-	SetChar(i++, 0xc6, 0xc6, 0xc6, 0x7c, 0x38, 0x38, 0x7c, 0x00);
-	SetChar(i++, 0xfe, 0xcc, 0x98, 0x30, 0x62, 0xc6, 0xfe, 0x00);
-	SetChar(i++, 0x78, 0x60, 0x60, 0x60, 0x60, 0x60, 0x78, 0x00);
-	SetChar(i++, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x00);
-	SetChar(i++, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00);
-	SetChar(i++, 0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff);
-	SetChar(i++, 0x38, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0xe0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xfc, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x1c, 0x0c, 0x0c, 0x7c, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00);
-	SetChar(i++, 0x3c, 0x66, 0x60, 0xf8, 0x60, 0x60, 0xf8, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7e, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8);
-	SetChar(i++, 0xe0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xe6, 0x00);
-	SetChar(i++, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x0c, 0x00, 0x1e, 0x06, 0x06, 0x66, 0x3c, 0x00);
-	SetChar(i++, 0xe0, 0x60, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x00);
-	SetChar(i++, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xec, 0xfe, 0xda, 0xda, 0xda, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0xf0);
-	SetChar(i++, 0x00, 0x00, 0x7e, 0xcc, 0xcc, 0x7c, 0x0c, 0x1e);
-	SetChar(i++, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x60, 0xf0, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7e, 0xc0, 0x7c, 0x06, 0xfc, 0x00);
-	SetChar(i++, 0x20, 0x60, 0xfc, 0x60, 0x60, 0x66, 0x3c, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x38, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xda, 0xda, 0xda, 0xda, 0x74, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0xfc, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xfe, 0x18, 0x30, 0x62, 0xfe, 0x00);
-	SetChar(i++, 0x0e, 0x18, 0x18, 0x70, 0x18, 0x18, 0x0e, 0x00);
-	SetChar(i++, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00);
-	SetChar(i++, 0x70, 0x18, 0x18, 0x0e, 0x18, 0x18, 0x70, 0x00);
-	SetChar(i++, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xfe, 0x00);
-	SetChar(i++, 0x7c, 0xc6, 0xc0, 0xc0, 0xc6, 0x7c, 0x18, 0x30);
-	SetChar(i++, 0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x18, 0x30, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00);
-	SetChar(i++, 0x30, 0x48, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x78, 0x0c, 0xfc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x30, 0x48, 0x78, 0x0c, 0xfc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x18, 0x30);
-	SetChar(i++, 0x30, 0x48, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00);
-	SetChar(i++, 0xcc, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 0x00);
-	SetChar(i++, 0x6c, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x38, 0x44, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x30, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0xcc, 0x30, 0x78, 0xcc, 0xcc, 0xfc, 0xcc, 0x00);
-	SetChar(i++, 0x30, 0x48, 0x78, 0xcc, 0xcc, 0xfc, 0xcc, 0x00);
-	SetChar(i++, 0x18, 0x30, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7e, 0x09, 0x7f, 0xc8, 0x7e, 0x00);
-	SetChar(i++, 0x3f, 0x6c, 0xcc, 0xff, 0xcc, 0xcc, 0xcf, 0x00);
-	SetChar(i++, 0x00, 0x38, 0x44, 0x7c, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x00, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x30, 0x48, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0xcc, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x7c, 0x00);
-	SetChar(i++, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x00);
-	SetChar(i++, 0x38, 0x6c, 0x64, 0xf0, 0x60, 0x66, 0xfc, 0x00);
-	SetChar(i++, 0x3a, 0x6c, 0xce, 0xd6, 0xe6, 0x6c, 0xb8, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xc6, 0x7c, 0x38, 0x7c, 0xc6, 0x00);
-	SetChar(i++, 0x0e, 0x1b, 0x18, 0x7e, 0x18, 0xd8, 0x70, 0x00);
-	SetChar(i++, 0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x0c, 0x18, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x18, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x76, 0xdc, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x00);
-	SetChar(i++, 0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00);
-	SetChar(i++, 0x70, 0xd0, 0x78, 0x00, 0xf8, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x70, 0xd8, 0x70, 0x00, 0xf8, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x30, 0x00, 0x30, 0x60, 0xc0, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0x3c, 0x42, 0xb9, 0xa5, 0xb9, 0xa5, 0x42, 0x3c);
-	SetChar(i++, 0x00, 0x00, 0x00, 0xfe, 0x06, 0x06, 0x00, 0x00);
-	SetChar(i++, 0xc6, 0x4c, 0x58, 0x36, 0x69, 0xc2, 0x84, 0x0f);
-	SetChar(i++, 0xc6, 0x4c, 0x58, 0x36, 0x6a, 0xdf, 0x82, 0x02);
-	SetChar(i++, 0x18, 0x00, 0x18, 0x18, 0x3c, 0x3c, 0x18, 0x00);
-	SetChar(i++, 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00);
-	SetChar(i++, 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00);
-	SetChar(i++, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22, 0x88);
-	SetChar(i++, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55);
-	SetChar(i++, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77, 0xdd, 0x77);
-	SetChar(i++, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18);
-	SetChar(i++, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18);
-	SetChar(i++, 0x18, 0x30, 0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0x00);
-	SetChar(i++, 0x38, 0x44, 0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0x00);
-	SetChar(i++, 0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c);
-	SetChar(i++, 0x24, 0x24, 0xe4, 0x04, 0x04, 0xe4, 0x24, 0x24);
-	SetChar(i++, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24);
-	SetChar(i++, 0x00, 0x00, 0xfc, 0x04, 0x04, 0xe4, 0x24, 0x24);
-	SetChar(i++, 0x24, 0x24, 0xe4, 0x04, 0x04, 0xfc, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18);
-	SetChar(i++, 0x66, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18);
-	SetChar(i++, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0x38, 0x18, 0x18);
-	SetChar(i++, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x18, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0x18, 0x18);
-	SetChar(i++, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18);
-	SetChar(i++, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18);
-	SetChar(i++, 0x76, 0xdc, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x76, 0xdc, 0x7c, 0xc6, 0xc6, 0xfe, 0xc6, 0x00);
-	SetChar(i++, 0x24, 0x24, 0x27, 0x20, 0x20, 0x3f, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x3f, 0x20, 0x20, 0x27, 0x24, 0x24);
-	SetChar(i++, 0x24, 0x24, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x24, 0x24);
-	SetChar(i++, 0x24, 0x24, 0x27, 0x20, 0x20, 0x27, 0x24, 0x24);
-	SetChar(i++, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00);
-	SetChar(i++, 0x24, 0x24, 0xe7, 0x00, 0x00, 0xe7, 0x24, 0x24);
-	SetChar(i++, 0x00, 0x82, 0xfe, 0x6c, 0xfe, 0x82, 0x00, 0x00);
-	SetChar(i++, 0x90, 0x60, 0x98, 0x0c, 0x7c, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00);
-	SetChar(i++, 0x38, 0x44, 0xfe, 0x60, 0x7c, 0x60, 0xfe, 0x00);
-	SetChar(i++, 0xc6, 0x00, 0xfe, 0x60, 0x7c, 0x60, 0xfe, 0x00);
-	SetChar(i++, 0x30, 0x18, 0xfe, 0x60, 0x7c, 0x60, 0xfe, 0x00);
-	SetChar(i++, 0x60, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x0c, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x18, 0x24, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x6c, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0x18, 0x18, 0x38, 0xf8, 0xf0, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x1c, 0x18, 0x18);
-	SetChar(i++, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff);
-	SetChar(i++, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00);
-	SetChar(i++, 0x30, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x3c, 0x00);
-	SetChar(i++, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x30, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x7c, 0xc6, 0xc6, 0xfc, 0xc6, 0xc6, 0xdc, 0xc0);
-	SetChar(i++, 0x38, 0x44, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x60, 0x30, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x76, 0xdc, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xc0);
-	SetChar(i++, 0x00, 0x70, 0x3c, 0x36, 0x3c, 0x30, 0x78, 0x00);
-	SetChar(i++, 0xf0, 0x60, 0x7c, 0x66, 0x7c, 0x60, 0xf0, 0x00);
-	SetChar(i++, 0x18, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x30, 0x48, 0x00, 0xcc, 0xcc, 0xcc, 0x78, 0x00);
-	SetChar(i++, 0x60, 0x30, 0xcc, 0xcc, 0xcc, 0xcc, 0x7e, 0x00);
-	SetChar(i++, 0x18, 0x30, 0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x7c);
-	SetChar(i++, 0x18, 0x30, 0xc6, 0xc6, 0x7c, 0x38, 0x7c, 0x00);
-	SetChar(i++, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00);
-	SetChar(i++, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0x00);
-	SetChar(i++, 0xe6, 0x2c, 0xf8, 0x36, 0xea, 0xdf, 0x82, 0x02);
-	SetChar(i++, 0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00);
-	SetChar(i++, 0x7e, 0xc3, 0x78, 0xcc, 0xcc, 0x78, 0x8c, 0xf8);
-	SetChar(i++, 0x30, 0x30, 0x00, 0xfc, 0x00, 0x30, 0x30, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60);
-	SetChar(i++, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x18, 0x78, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x78, 0x0c, 0x38, 0x0c, 0x78, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x78, 0x0c, 0x38, 0x60, 0x7c, 0x00, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00);
-	SetChar(i++, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+	for (; i < 16; i++)
+		Palette[i] = ansi[i];
+
+	for (int r = 0; r < 6; r++)
+		for (int g = 0; g < 6; g++)
+			for (int b = 0; b < 6; b++)
+				Palette[i++] = (levels[r] << 16) | (levels[g] << 8) | levels[b];
+
+	for (int grey = 0; grey < 24; grey++)
+	{
+		const int level = 8 + grey * 10;
+		Palette[i++] = (level << 16) | (level << 8) | level;
+	}
 }
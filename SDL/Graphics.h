@@ -1,7 +1,14 @@
 #ifndef _GRAPHICS_H_
 #define _GRAPHICS_H_
 
+#include <vector>
 #include <SDL.h>
+#include "FrameProfiler.h"
+#include "Tracer.h"
+#include "SnapshotStack.h"
+#include "Blend.h"
+#include "Cell.h"
+#include "GlyphMap.h"
 
 #define SCREEN_W 256
 #define SCREEN_H 192
@@ -11,42 +18,176 @@
 #define CHAR_H 8
 #define CHAR_SIZE (CHAR_W * CHAR_H)
 #define CHARSET_SIZE 512
+#define PALETTE_SIZE 256
 #define COLS (SCREEN_W / CHAR_W)
 #define ROWS (SCREEN_H / CHAR_H)
+#define MONO_PITCH (SCREEN_W / 8)
+#define MAX_DIRTY_RECTS (COLS * ROWS)
 
 #define CHARSET_FILE "charset.dat"
+#define STATE_MAGIC 0x53535458
+#define STATE_VERSION 1
+#define STATE_COMPRESSED 0x01
 
 typedef unsigned char byte;
 
+class Font;
+class Canvas;
+class LatencyProbe;
+class AssetLoader;
+class Scheduler;
+
+// Leads every savestate blob. Hash covers the uncompressed payload.
+struct GraphicsStateHeader
+{
+	Uint32 Magic;
+	Uint32 Version;
+	Uint32 Flags;
+	Uint32 PayloadSize;
+	Uint64 RawSize;
+	Uint64 Hash;
+};
+
+enum DrawMode
+{
+	DRAW_COPY = 0,
+	DRAW_OR = 1,
+	DRAW_XOR = 2
+};
+
+enum GlyphTransform
+{
+	GLYPH_NORMAL = 0,
+	GLYPH_FLIP_X = 1,
+	GLYPH_FLIP_Y = 2,
+	GLYPH_ROTATE_90 = 4,
+	GLYPH_ROTATE_180 = GLYPH_FLIP_X | GLYPH_FLIP_Y,
+	GLYPH_ROTATE_270 = GLYPH_ROTATE_90 | GLYPH_FLIP_X | GLYPH_FLIP_Y,
+	GLYPH_TRANSFORMS = 8
+};
+
+// Pixel rectangle the rasterizers draw into: the screen Buffer by default,
+// or a Canvas while one of its draw calls runs. Pitch counts pixels.
+struct Surface
+{
+	int* Pixels;
+	int Pitch;
+	SDL_Rect Clip;
+};
+
+static_assert(GLYPHMAP_GLYPHS == CHARSET_SIZE, "GlyphMap must cover the whole charset");
+
 class Graphics
 {
 public:
 	byte Charset[CHARSET_SIZE][CHAR_H];
+	int Palette[PALETTE_SIZE];
 	int Buffer[SCREEN_H][SCREEN_W];
+	byte MonoBuffer[SCREEN_H][MONO_PITCH];
+	GlyphMap Codepoints;
 
-	Graphics(int bgcolor, bool fullscreen);
+	Graphics(int bgcolor, bool fullscreen, bool headless = false);
 	~Graphics();
 
 	void ClearCharset();
 	void SetupDefaultCharset();
+	void SetupDefaultPalette();
 	void ToggleFullscreen();
 	void Update();
 	void Clear(int color);
+	void ScrollBuffer(int pixels);
 	void SetPixel(int x, int y, int color);
+	void PlotPixels(const int* xs, const int* ys, const int* colors, int count);
 	void SetChar(int chr, int row1, int row2, int row3, int row4, int row5, int row6, int row7, int row8);
-	void PutChar(int chr, int x, int y, int forecolor, int backcolor);
-	void DrawChar(int chr, int x, int y, int forecolor, int backcolor);
+	void PutChar(int chr, int x, int y, int forecolor, int backcolor, int transform = GLYPH_NORMAL);
+	void DrawChar(int chr, int x, int y, int forecolor, int backcolor, int transform = GLYPH_NORMAL);
+	void PutChar(const Font& font, int chr, int x, int y, int forecolor, int backcolor);
+	void DrawChar(const Font& font, int chr, int x, int y, int forecolor, int backcolor);
+	void PutCell(Cell cell, int x, int y);
+	void DrawCells(const Cell* cells, int count, int x, int y);
+	void DrawCellBlock(const Cell* cells, int pitch, int x, int y, int w, int h);
 	void Print(int x, int y, int forecolor, int backcolor, const char* fmt, ...);
+	void PrintUtf8(int x, int y, int forecolor, int backcolor, const char* fmt, ...);
 	void SaveCharset(const char* filename);
 	void LoadCharset(const char* filename);
+	void SaveState(std::vector<Uint8>& blob, bool compress = false);
+	bool LoadState(const void* blob, size_t size);
+	void InvalidateGlyphCache();
+	void ReadPixels(Uint32* pixels, int pitch);
+	void SetAutoDamage(bool enabled);
+	const SDL_Rect* GetDirtyRects(int& count);
+	void SetMonochrome(bool enabled, int forecolor, int backcolor);
+	bool IsMonochrome();
+	void SetDrawMode(DrawMode mode);
+	void SetLatencyProbe(LatencyProbe* probe);
+	void SetAssetLoader(AssetLoader* loader);
+	void SetScheduler(Scheduler* scheduler);
+	void PushScreen();
+	bool PopScreen();
+	void DrawLine(int x1, int y1, int x2, int y2, int color);
+	void DrawRect(int x, int y, int w, int h, int color);
+	void FillRect(int x, int y, int w, int h, int color);
+	void DrawCircle(int cx, int cy, int radius, int color);
+	void FillCircle(int cx, int cy, int radius, int color);
+	void DrawEllipse(int cx, int cy, int rx, int ry, int color);
+	void FillEllipse(int cx, int cy, int rx, int ry, int color);
+	void DrawPolygon(const SDL_Point* points, int count, int color);
+	void FillPolygon(const SDL_Point* points, int count, int color);
+	void BlitImage(const Uint32* pixels, int w, int h, int pitch, int x, int y, BlendMode mode, Uint32 colorkey = 0);
+	void DrawCanvas(const Canvas& canvas, int x, int y);
+#ifdef GRAPHICS_PROFILE
+	void GetFrameStats(FrameStats& stats);
+	void SetFrameTimingCallback(FrameTimingCallback callback);
+#endif
 
 private:
+	friend class Canvas;
+
 	SDL_Window* Window;
 	SDL_Renderer* Renderer;
 	SDL_Texture* ScreenTexture;
 
-	void Init(bool fullscreen);
+	bool Monochrome;
+	int MonoForeColor;
+	int MonoBackColor;
+	DrawMode Mode;
+	Surface Target;
+	bool TargetScreen;
+	LatencyProbe* Probe;
+	AssetLoader* Loader;
+	Scheduler* Tasks;
+	SnapshotStack Snapshots;
+	byte TransformedCharset[GLYPH_TRANSFORMS][CHARSET_SIZE][CHAR_H];
+	Uint32 TransformedValid[GLYPH_TRANSFORMS][CHARSET_SIZE / 32];
+	bool AutoDamage;
+	bool LastFrameValid;
+	int LastFrame[SCREEN_H][SCREEN_W];
+	byte LastMono[SCREEN_H][MONO_PITCH];
+	byte TileDirty[ROWS][COLS];
+	SDL_Rect DirtyRects[MAX_DIRTY_RECTS];
+	int DirtyCount;
+#ifdef GRAPHICS_PROFILE
+	FrameProfiler Profiler;
+#endif
+
+	void Init(bool fullscreen, bool headless);
 	void Dispose();
+	bool Present();
+	bool DiffFrame();
+	void DiffTiles();
+	void BuildDirtyRects();
+	void Damage(int x, int y, int w, int h);
+	void SetTarget(const Surface* surface);
+	bool DrawsMono() const;
+	void FillSpan(int x1, int x2, int y, int color);
+	void PlotClipped(int x, int y, int color);
+	void EllipseRows(int cx, int cy, int x, int y, int color, bool filled);
+	void RasterizeEllipse(int cx, int cy, int rx, int ry, int color, bool filled);
+	void UploadMono(Uint32* pixels, int pitch);
+	template <int H> void DrawGlyph(const byte* pixels, int x, int y, int forecolor, int backcolor, int height);
+	void DrawCharMono(const byte* pixels, int height, int x, int y, int forecolor, int backcolor);
+	const byte* GetGlyph(int chr, int transform);
+	void WriteMonoRow(int y, int x, byte set, byte clear, byte toggle);
 };
 
 #endif
@@ -0,0 +1,96 @@
+#include "Hash.h"
+
+#define PRIME64_1 0x9e3779b185ebca87ULL
+#define PRIME64_2 0xc2b2ae3d27d4eb4fULL
+#define PRIME64_3 0x165667b19e3779f9ULL
+#define PRIME64_4 0x85ebca77c2b2ae63ULL
+#define PRIME64_5 0x27d4eb2f165667c5ULL
+
+static inline Uint64 RotateLeft(Uint64 value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+static inline Uint64 Read64(const Uint8* p)
+{
+	Uint64 value;
+	SDL_memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static inline Uint32 Read32(const Uint8* p)
+{
+	Uint32 value;
+	SDL_memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static inline Uint64 Round(Uint64 acc, Uint64 input)
+{
+	acc += input * PRIME64_2;
+	acc = RotateLeft(acc, 31);
+	return acc * PRIME64_1;
+}
+
+static inline Uint64 MergeRound(Uint64 acc, Uint64 value)
+{
+	acc ^= Round(0, value);
+	return acc * PRIME64_1 + PRIME64_4;
+}
+
+Uint64 HashBytes(const void* data, size_t size, Uint64 seed)
+{
+	const Uint8* p = (const Uint8*)data;
+	const Uint8* end = p + size;
+	Uint64 hash;
+
+	if (size >= 32)
+	{
+		const Uint8* limit = end - 32;
+		Uint64 v1 = seed + PRIME64_1 + PRIME64_2;
+		Uint64 v2 = seed + PRIME64_2;
+		Uint64 v3 = seed;
+		Uint64 v4 = seed - PRIME64_1;
+
+		do
+		{
+			v1 = Round(v1, Read64(p));
+			v2 = Round(v2, Read64(p + 8));
+			v3 = Round(v3, Read64(p + 16));
+			v4 = Round(v4, Read64(p + 24));
+			p += 32;
+		}
+		while (p <= limit);
+
+		hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+		hash = MergeRound(hash, v1);
+		hash = MergeRound(hash, v2);
+		hash = MergeRound(hash, v3);
+		hash = MergeRound(hash, v4);
+	}
+	else
+	{
+		hash = seed + PRIME64_5;
+	}
+
+	hash += size;
+
+	for (; p + 8 <= end; p += 8)
+		hash = RotateLeft(hash ^ Round(0, Read64(p)), 27) * PRIME64_1 + PRIME64_4;
+
+	if (p + 4 <= end)
+	{
+		hash = RotateLeft(hash ^ (Read32(p) * PRIME64_1), 23) * PRIME64_2 + PRIME64_3;
+		p += 4;
+	}
+
+	for (; p < end; p++)
+		hash = RotateLeft(hash ^ (*p * PRIME64_5), 11) * PRIME64_1;
+
+	hash ^= hash >> 33;
+	hash *= PRIME64_2;
+	hash ^= hash >> 29;
+	hash *= PRIME64_3;
+	hash ^= hash >> 32;
+	return hash;
+}
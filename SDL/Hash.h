@@ -0,0 +1,10 @@
+#ifndef _HASH_H_
+#define _HASH_H_
+
+#include <stddef.h>
+#include <SDL.h>
+
+// 64-bit xxHash (XXH64) of a block of memory
+Uint64 HashBytes(const void* data, size_t size, Uint64 seed = 0);
+
+#endif
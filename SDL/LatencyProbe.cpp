@@ -0,0 +1,125 @@
+#include <algorithm>
+#include "LatencyProbe.h"
+
+LatencyProbe::LatencyProbe()
+{
+	MsPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+	Reset();
+}
+
+bool LatencyProbe::IsInputEvent(Uint32 type)
+{
+	switch (type)
+	{
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+		case SDL_TEXTINPUT:
+		case SDL_MOUSEMOTION:
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP:
+		case SDL_MOUSEWHEEL:
+		case SDL_JOYBUTTONDOWN:
+		case SDL_JOYBUTTONUP:
+		case SDL_CONTROLLERBUTTONDOWN:
+		case SDL_CONTROLLERBUTTONUP:
+		case SDL_FINGERDOWN:
+		case SDL_FINGERUP:
+			return true;
+		default:
+			return false;
+	}
+}
+
+int LatencyProbe::PollEvent(SDL_Event* event)
+{
+	const int result = SDL_PollEvent(event);
+
+	if (result && event && IsInputEvent(event->type) && PendingCount < LATENCY_MAX_PENDING)
+		Pending[PendingCount++] = SDL_GetPerformanceCounter();
+
+	return result;
+}
+
+void LatencyProbe::MarkResponse()
+{
+	for (int i = 0; i < PendingCount && RespondedCount < LATENCY_MAX_PENDING; i++)
+		Responded[RespondedCount++] = Pending[i];
+
+	PendingCount = 0;
+}
+
+void LatencyProbe::OnPresent()
+{
+	if (RespondedCount == 0)
+		return;
+
+	const Uint64 now = SDL_GetPerformanceCounter();
+
+	for (int i = 0; i < RespondedCount; i++)
+	{
+		Samples[SampleHead] = (now - Responded[i]) * MsPerTick;
+		SampleHead = (SampleHead + 1) % LATENCY_SAMPLES;
+		if (SampleCount < LATENCY_SAMPLES)
+			SampleCount++;
+	}
+
+	RespondedCount = 0;
+}
+
+static double Percentile(const double* sorted, int count, int percent)
+{
+	int rank = (percent * count + 99) / 100;
+	if (rank < 1)
+		rank = 1;
+
+	return sorted[rank - 1];
+}
+
+void LatencyProbe::GetReport(LatencyReport& report)
+{
+	SDL_memset(&report, 0, sizeof(report));
+	report.Samples = SampleCount;
+
+	if (SampleCount == 0)
+		return;
+
+	double sorted[LATENCY_SAMPLES];
+	SDL_memcpy(sorted, Samples, SampleCount * sizeof(double));
+	std::sort(sorted, sorted + SampleCount);
+
+	report.P50 = Percentile(sorted, SampleCount, 50);
+	report.P90 = Percentile(sorted, SampleCount, 90);
+	report.P99 = Percentile(sorted, SampleCount, 99);
+	report.Max = sorted[SampleCount - 1];
+}
+
+void LatencyProbe::Reset()
+{
+	PendingCount = 0;
+	RespondedCount = 0;
+	SampleHead = 0;
+	SampleCount = 0;
+}
+
+void LatencyProbe::InjectKey(SDL_Keycode key, bool pressed)
+{
+	SDL_Event event;
+	SDL_memset(&event, 0, sizeof(event));
+	event.type = pressed ? SDL_KEYDOWN : SDL_KEYUP;
+	event.key.state = pressed ? SDL_PRESSED : SDL_RELEASED;
+	event.key.keysym.sym = key;
+	SDL_PushEvent(&event);
+}
+
+void LatencyProbe::InjectMouseButton(int button, int x, int y, bool pressed)
+{
+	SDL_Event event;
+	SDL_memset(&event, 0, sizeof(event));
+	event.type = pressed ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+	event.button.button = button;
+	event.button.state = pressed ? SDL_PRESSED : SDL_RELEASED;
+	event.button.clicks = 1;
+	event.button.x = x;
+	event.button.y = y;
+	SDL_PushEvent(&event);
+}
@@ -0,0 +1,46 @@
+#ifndef _LATENCYPROBE_H_
+#define _LATENCYPROBE_H_
+
+#include <SDL.h>
+
+#define LATENCY_MAX_PENDING 256
+#define LATENCY_SAMPLES 4096
+
+// Input-to-photon latencies in milliseconds
+struct LatencyReport
+{
+	int Samples;
+	double P50;
+	double P90;
+	double P99;
+	double Max;
+};
+
+class LatencyProbe
+{
+public:
+	LatencyProbe();
+
+	int PollEvent(SDL_Event* event);
+	void MarkResponse();
+	void OnPresent();
+	void GetReport(LatencyReport& report);
+	void Reset();
+
+	static void InjectKey(SDL_Keycode key, bool pressed);
+	static void InjectMouseButton(int button, int x, int y, bool pressed);
+
+private:
+	Uint64 Pending[LATENCY_MAX_PENDING];
+	int PendingCount;
+	Uint64 Responded[LATENCY_MAX_PENDING];
+	int RespondedCount;
+	double Samples[LATENCY_SAMPLES];
+	int SampleHead;
+	int SampleCount;
+	double MsPerTick;
+
+	static bool IsInputEvent(Uint32 type);
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+{
+	File = NULL;
+	Mapping = NULL;
+	View = NULL;
+	ViewSize = 0;
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+bool MappedFile::Open(const char* filename, bool randomAccess)
+{
+	Close();
+
+#ifdef _WIN32
+	const DWORD flags = randomAccess ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN;
+	HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	HANDLE mapping = GetFileSizeEx(file, &size) && size.QuadPart > 0 ? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	File = file;
+	Mapping = mapping;
+	ViewSize = (size_t)size.QuadPart;
+	View = (const Uint8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+	const int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	void* view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+		return false;
+
+	madvise(view, (size_t)info.st_size, randomAccess ? MADV_RANDOM : MADV_SEQUENTIAL);
+	ViewSize = (size_t)info.st_size;
+	View = (const Uint8*)view;
+#endif
+
+	if (!View)
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+#ifdef _WIN32
+	if (View)
+		UnmapViewOfFile(View);
+	if (Mapping)
+		CloseHandle((HANDLE)Mapping);
+	if (File)
+		CloseHandle((HANDLE)File);
+#else
+	if (View)
+		munmap((void*)View, ViewSize);
+#endif
+
+	File = NULL;
+	Mapping = NULL;
+	View = NULL;
+	ViewSize = 0;
+}
+
+const Uint8* MappedFile::Data()
+{
+	return View;
+}
+
+size_t MappedFile::Size()
+{
+	return ViewSize;
+}
@@ -0,0 +1,30 @@
+#ifndef _MAPPEDFILE_H_
+#define _MAPPEDFILE_H_
+
+#include <stddef.h>
+#include <SDL.h>
+
+// Read-only memory mapping of a whole file
+class MappedFile
+{
+public:
+	MappedFile();
+	~MappedFile();
+
+	bool Open(const char* filename, bool randomAccess = false);
+	void Close();
+
+	const Uint8* Data();
+	size_t Size();
+
+private:
+	void* File;
+	void* Mapping;
+	const Uint8* View;
+	size_t ViewSize;
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif
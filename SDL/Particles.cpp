@@ -0,0 +1,169 @@
+#include "Particles.h"
+#include "Simd.h"
+
+#define PARTICLE_ARRAYS 8
+#define PARTICLE_COORD_LIMIT 16777216.0f
+
+// Positions this far out are off screen anyway; clamping them, and NaN,
+// keeps the conversion to int defined
+static inline int FloorToPixel(float value)
+{
+	if (!(value > -PARTICLE_COORD_LIMIT))
+		value = -PARTICLE_COORD_LIMIT;
+	else if (value > PARTICLE_COORD_LIMIT)
+		value = PARTICLE_COORD_LIMIT;
+
+	return (int)SDL_floorf(value);
+}
+
+ParticleSystem::ParticleSystem(int capacity)
+{
+	// Round up to whole vectors so the kernels never need a scalar tail
+	Size = (SDL_max(capacity, 1) + 3) & ~3;
+	Live = 0;
+	GravityX = 0;
+	GravityY = 0;
+
+	const size_t bytes = (size_t)Size * sizeof(float);
+	Block = SDL_SIMDAlloc(bytes * PARTICLE_ARRAYS);
+
+	// Without storage the system has no capacity and Emit() always fails
+	if (!Block)
+	{
+		Size = 0;
+		X = Y = VX = VY = NULL;
+		Life = Color = PixelX = PixelY = NULL;
+		return;
+	}
+
+	SDL_memset(Block, 0, bytes * PARTICLE_ARRAYS);
+
+	Uint8* base = (Uint8*)Block;
+	X = (float*)(base);
+	Y = (float*)(base + bytes);
+	VX = (float*)(base + bytes * 2);
+	VY = (float*)(base + bytes * 3);
+	Life = (int*)(base + bytes * 4);
+	Color = (int*)(base + bytes * 5);
+	PixelX = (int*)(base + bytes * 6);
+	PixelY = (int*)(base + bytes * 7);
+}
+
+ParticleSystem::~ParticleSystem()
+{
+	SDL_SIMDFree(Block);
+}
+
+bool ParticleSystem::Emit(float x, float y, float vx, float vy, int life, int color)
+{
+	if (Live == Size || life <= 0)
+		return false;
+
+	const int i = Live++;
+	X[i] = x;
+	Y[i] = y;
+	VX[i] = vx;
+	VY[i] = vy;
+	Life[i] = life;
+	Color[i] = color;
+	PixelX[i] = FloorToPixel(x);
+	PixelY[i] = FloorToPixel(y);
+	return true;
+}
+
+void ParticleSystem::SetGravity(float gx, float gy)
+{
+	GravityX = gx;
+	GravityY = gy;
+}
+
+void ParticleSystem::Clear()
+{
+	Live = 0;
+}
+
+int ParticleSystem::Count()
+{
+	return Live;
+}
+
+int ParticleSystem::Capacity()
+{
+	return Size;
+}
+
+#ifdef HAVE_SSE2
+static inline __m128i FloorToInt(__m128 value)
+{
+	// Same clamp as FloorToPixel; max_ps returns its second operand for NaN
+	value = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-PARTICLE_COORD_LIMIT)), _mm_set1_ps(PARTICLE_COORD_LIMIT));
+
+	// Truncation rounds negative values up; take one off where that happened
+	const __m128i truncated = _mm_cvttps_epi32(value);
+	const __m128 back = _mm_cvtepi32_ps(truncated);
+	return _mm_add_epi32(truncated, _mm_castps_si128(_mm_cmpgt_ps(back, value)));
+}
+#endif
+
+void ParticleSystem::Update()
+{
+	TRACE_SCOPE("ParticleSystem::Update");
+	int i = 0;
+
+#ifdef HAVE_SSE2
+	const __m128 gx = _mm_set1_ps(GravityX);
+	const __m128 gy = _mm_set1_ps(GravityY);
+	const __m128i one = _mm_set1_epi32(1);
+
+	for (; i < Live; i += 4)
+	{
+		const __m128 x = _mm_add_ps(_mm_load_ps(X + i), _mm_load_ps(VX + i));
+		const __m128 y = _mm_add_ps(_mm_load_ps(Y + i), _mm_load_ps(VY + i));
+		_mm_store_ps(X + i, x);
+		_mm_store_ps(Y + i, y);
+		_mm_store_ps(VX + i, _mm_add_ps(_mm_load_ps(VX + i), gx));
+		_mm_store_ps(VY + i, _mm_add_ps(_mm_load_ps(VY + i), gy));
+		_mm_store_si128((__m128i*)(Life + i), _mm_sub_epi32(_mm_load_si128((const __m128i*)(Life + i)), one));
+		_mm_store_si128((__m128i*)(PixelX + i), FloorToInt(x));
+		_mm_store_si128((__m128i*)(PixelY + i), FloorToInt(y));
+	}
+#else
+	for (; i < Live; i++)
+	{
+		X[i] += VX[i];
+		Y[i] += VY[i];
+		VX[i] += GravityX;
+		VY[i] += GravityY;
+		Life[i]--;
+		PixelX[i] = FloorToPixel(X[i]);
+		PixelY[i] = FloorToPixel(Y[i]);
+	}
+#endif
+
+	for (i = 0; i < Live;)
+	{
+		if (Life[i] <= 0)
+			Remove(i);
+		else
+			i++;
+	}
+}
+
+void ParticleSystem::Remove(int index)
+{
+	const int last = --Live;
+
+	X[index] = X[last];
+	Y[index] = Y[last];
+	VX[index] = VX[last];
+	VY[index] = VY[last];
+	Life[index] = Life[last];
+	Color[index] = Color[last];
+	PixelX[index] = PixelX[last];
+	PixelY[index] = PixelY[last];
+}
+
+void ParticleSystem::Render(Graphics& gfx)
+{
+	gfx.PlotPixels(PixelX, PixelY, Color, Live);
+}
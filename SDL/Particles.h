@@ -0,0 +1,42 @@
+#ifndef _PARTICLES_H_
+#define _PARTICLES_H_
+
+#include "Graphics.h"
+
+// Point particles stored as separate arrays so the update runs four lanes
+// at a time. Dead particles are replaced by the last live one, so removal
+// moves one particle and the arrays never reallocate.
+class ParticleSystem
+{
+public:
+	ParticleSystem(int capacity);
+	~ParticleSystem();
+
+	bool Emit(float x, float y, float vx, float vy, int life, int color);
+	void SetGravity(float gx, float gy);
+	void Update();
+	void Render(Graphics& gfx);
+	void Clear();
+
+	int Count();
+	int Capacity();
+
+private:
+	int Size;
+	int Live;
+	float GravityX;
+	float GravityY;
+	void* Block;
+	float* X;
+	float* Y;
+	float* VX;
+	float* VY;
+	int* Life;
+	int* Color;
+	int* PixelX;
+	int* PixelY;
+
+	void Remove(int index);
+};
+
+#endif
@@ -0,0 +1,180 @@
+#include <new>
+#include "Scheduler.h"
+#include "Tracer.h"
+
+static void* FreeLists[TASK_POOL_CLASSES];
+static std::vector<void*> Chunks;
+static size_t ChunkUsed = TASK_POOL_CHUNK;
+
+void* TaskPool::Allocate(size_t size)
+{
+	const size_t sizeClass = (size + TASK_POOL_GRANULE - 1) / TASK_POOL_GRANULE;
+	if (sizeClass > TASK_POOL_CLASSES)
+		return ::operator new(size);
+
+	void*& head = FreeLists[sizeClass - 1];
+	if (head)
+	{
+		void* block = head;
+		head = *(void**)block;
+		return block;
+	}
+
+	const size_t bytes = sizeClass * TASK_POOL_GRANULE;
+	if (ChunkUsed + bytes > TASK_POOL_CHUNK)
+	{
+		Chunks.push_back(::operator new(TASK_POOL_CHUNK));
+		ChunkUsed = 0;
+	}
+
+	void* block = (Uint8*)Chunks.back() + ChunkUsed;
+	ChunkUsed += bytes;
+	return block;
+}
+
+void TaskPool::Free(void* block, size_t size)
+{
+	const size_t sizeClass = (size + TASK_POOL_GRANULE - 1) / TASK_POOL_GRANULE;
+	if (sizeClass > TASK_POOL_CLASSES)
+	{
+		::operator delete(block);
+		return;
+	}
+
+	void*& head = FreeLists[sizeClass - 1];
+	*(void**)block = head;
+	head = block;
+}
+
+size_t TaskPool::MemoryUsed()
+{
+	return Chunks.size() * TASK_POOL_CHUNK;
+}
+
+Task Task::promise_type::get_return_object()
+{
+	return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+Task::Task(std::coroutine_handle<promise_type> handle)
+{
+	Handle = handle;
+}
+
+Task::Task(Task&& other) noexcept
+{
+	Handle = other.Handle;
+	other.Handle = NULL;
+}
+
+Task::~Task()
+{
+	if (Handle)
+		Handle.destroy();
+}
+
+Scheduler::Scheduler()
+{
+	CurrentFrame = 0;
+	Sequence = 0;
+}
+
+Scheduler::~Scheduler()
+{
+	Clear();
+}
+
+void Scheduler::Clear()
+{
+	// Suspended frames are owned by the scheduler and are destroyed in place
+	for (size_t i = 0; i < Ready.size(); i++)
+		Ready[i].destroy();
+	Ready.clear();
+
+	while (!Timers.empty())
+	{
+		Timers.top().Handle.destroy();
+		Timers.pop();
+	}
+
+	for (size_t i = 0; i < Assets.size(); i++)
+		Assets[i].Handle.destroy();
+	Assets.clear();
+}
+
+void Scheduler::Spawn(Task task)
+{
+	Ready.push_back(task.Handle);
+	task.Handle = NULL;
+}
+
+void Scheduler::Tick()
+{
+	TRACE_SCOPE("Scheduler::Tick");
+	CurrentFrame++;
+
+	while (!Timers.empty() && Timers.top().WakeFrame <= CurrentFrame)
+	{
+		Ready.push_back(Timers.top().Handle);
+		Timers.pop();
+	}
+
+	for (size_t i = 0; i < Assets.size();)
+	{
+		if (Assets[i].Result->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+		{
+			Ready.push_back(Assets[i].Handle);
+			Assets[i] = Assets.back();
+			Assets.pop_back();
+		}
+		else
+		{
+			i++;
+		}
+	}
+
+	// Tasks that await the next frame while running land in Ready again
+	// and wait for the following Tick
+	Running.swap(Ready);
+	for (size_t i = 0; i < Running.size(); i++)
+		Running[i].resume();
+	Running.clear();
+}
+
+Scheduler::FrameAwaiter Scheduler::NextFrame()
+{
+	return FrameAwaiter{ *this, 0 };
+}
+
+Scheduler::FrameAwaiter Scheduler::Delay(int frames)
+{
+	return FrameAwaiter{ *this, frames > 1 ? CurrentFrame + frames : 0 };
+}
+
+Scheduler::AssetAwaiter Scheduler::WaitFor(std::future<bool>& result)
+{
+	return AssetAwaiter{ *this, result };
+}
+
+void Scheduler::Suspend(std::coroutine_handle<> handle, Uint64 wakeFrame)
+{
+	if (wakeFrame == 0)
+		Ready.push_back(handle);
+	else
+		Timers.push(Timer{ wakeFrame, Sequence++, handle });
+}
+
+void Scheduler::WaitAsset(std::coroutine_handle<> handle, std::future<bool>& result)
+{
+	Assets.push_back(AssetWait{ handle, &result });
+}
+
+Uint64 Scheduler::Frame()
+{
+	return CurrentFrame;
+}
+
+int Scheduler::Pending()
+{
+	return (int)(Ready.size() + Timers.size() + Assets.size());
+}
@@ -0,0 +1,125 @@
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#include <coroutine>
+#include <future>
+#include <queue>
+#include <vector>
+#include <SDL.h>
+
+#define TASK_POOL_GRANULE 64
+#define TASK_POOL_CLASSES 16
+#define TASK_POOL_CHUNK 65536
+
+// Coroutine frames are small and short-lived, so they come from size-class
+// free lists carved out of large chunks. The pool is not thread-safe; tasks
+// are created and resumed on the frame loop thread.
+class TaskPool
+{
+public:
+	static void* Allocate(size_t size);
+	static void Free(void* block, size_t size);
+	static size_t MemoryUsed();
+};
+
+// Return type of a scheduled coroutine. The frame is released when the
+// coroutine finishes; a Task that is never spawned destroys it unstarted.
+class Task
+{
+public:
+	struct promise_type
+	{
+		Task get_return_object();
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+
+		static void* operator new(size_t size) { return TaskPool::Allocate(size); }
+		static void operator delete(void* block, size_t size) { TaskPool::Free(block, size); }
+	};
+
+	Task(Task&& other) noexcept;
+	~Task();
+
+private:
+	friend class Scheduler;
+
+	std::coroutine_handle<promise_type> Handle;
+
+	Task(std::coroutine_handle<promise_type> handle);
+	Task(const Task&) = delete;
+	Task& operator=(const Task&) = delete;
+};
+
+// Resumes tasks in one batch per frame. Graphics::Update() calls Tick()
+// after publishing assets. Tasks waiting on a delay sit in a heap ordered
+// by wake frame and cost nothing until they are due.
+class Scheduler
+{
+public:
+	struct FrameAwaiter
+	{
+		Scheduler& Owner;
+		Uint64 WakeFrame;
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle) { Owner.Suspend(handle, WakeFrame); }
+		void await_resume() const noexcept {}
+	};
+
+	struct AssetAwaiter
+	{
+		Scheduler& Owner;
+		std::future<bool>& Result;
+
+		bool await_ready() const { return Result.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+		void await_suspend(std::coroutine_handle<> handle) { Owner.WaitAsset(handle, Result); }
+		bool await_resume() { return Result.get(); }
+	};
+
+	Scheduler();
+	~Scheduler();
+
+	void Spawn(Task task);
+	void Tick();
+	void Clear();
+
+	FrameAwaiter NextFrame();
+	FrameAwaiter Delay(int frames);
+	AssetAwaiter WaitFor(std::future<bool>& result);
+
+	Uint64 Frame();
+	int Pending();
+
+private:
+	struct Timer
+	{
+		Uint64 WakeFrame;
+		Uint64 Sequence;
+		std::coroutine_handle<> Handle;
+
+		bool operator>(const Timer& other) const
+		{
+			return WakeFrame != other.WakeFrame ? WakeFrame > other.WakeFrame : Sequence > other.Sequence;
+		}
+	};
+
+	struct AssetWait
+	{
+		std::coroutine_handle<> Handle;
+		std::future<bool>* Result;
+	};
+
+	Uint64 CurrentFrame;
+	Uint64 Sequence;
+	std::vector<std::coroutine_handle<>> Ready;
+	std::vector<std::coroutine_handle<>> Running;
+	std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> Timers;
+	std::vector<AssetWait> Assets;
+
+	void Suspend(std::coroutine_handle<> handle, Uint64 wakeFrame);
+	void WaitAsset(std::coroutine_handle<> handle, std::future<bool>& result);
+};
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef _SIMD_H_
+#define _SIMD_H_
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#endif
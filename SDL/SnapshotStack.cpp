@@ -0,0 +1,113 @@
+#include "SnapshotStack.h"
+
+SnapshotStack::SnapshotStack()
+{
+	Count = 0;
+	Top = NULL;
+}
+
+SnapshotStack::~SnapshotStack()
+{
+	for (size_t i = 0; i < Levels.size(); i++)
+		delete Levels[i];
+}
+
+void SnapshotStack::Push(Uint8* base, int pitch, int tileBytes, int tileRows, int cols, int rows)
+{
+	if (Count == (int)Levels.size())
+		Levels.push_back(new Level());
+
+	Level* level = Levels[Count++];
+	level->Base = base;
+	level->Pitch = pitch;
+	level->TileBytes = tileBytes;
+	level->TileRows = tileRows;
+	level->Cols = cols;
+	level->Rows = rows;
+	level->Saved.assign((cols * rows + 31) / 32, 0);
+	level->Tiles.clear();
+	level->Data.clear();
+
+	Top = level;
+}
+
+bool SnapshotStack::Pop()
+{
+	if (!Top)
+		return false;
+
+	const Level& level = *Top;
+	const Uint8* src = level.Data.data();
+
+	for (size_t i = 0; i < level.Tiles.size(); i++)
+	{
+		const int tile = level.Tiles[i];
+		Uint8* dst = level.Base + (tile / level.Cols) * level.TileRows * level.Pitch + (tile % level.Cols) * level.TileBytes;
+
+		for (int row = 0; row < level.TileRows; row++, dst += level.Pitch, src += level.TileBytes)
+			SDL_memcpy(dst, src, level.TileBytes);
+	}
+
+	Count--;
+	Top = Count > 0 ? Levels[Count - 1] : NULL;
+	return true;
+}
+
+void SnapshotStack::Clear()
+{
+	Count = 0;
+	Top = NULL;
+}
+
+int SnapshotStack::Depth()
+{
+	return Count;
+}
+
+size_t SnapshotStack::MemoryUsed()
+{
+	size_t total = 0;
+
+	for (int i = 0; i < Count; i++)
+	{
+		const Level& level = *Levels[i];
+		total += level.Saved.size() * sizeof(Uint32) + level.Tiles.size() * sizeof(int) + level.Data.size();
+	}
+
+	return total;
+}
+
+void SnapshotStack::Save(int col1, int row1, int col2, int row2)
+{
+	Level& level = *Top;
+
+	if (col1 < 0) col1 = 0;
+	if (row1 < 0) row1 = 0;
+	if (col2 >= level.Cols) col2 = level.Cols - 1;
+	if (row2 >= level.Rows) row2 = level.Rows - 1;
+
+	for (int row = row1; row <= row2; row++)
+	{
+		for (int col = col1; col <= col2; col++)
+		{
+			const int tile = row * level.Cols + col;
+			Uint32& word = level.Saved[tile >> 5];
+			const Uint32 bit = 1u << (tile & 31);
+
+			if (word & bit)
+				continue;
+
+			word |= bit;
+			level.Tiles.push_back(tile);
+
+			const size_t offset = level.Data.size();
+			level.Data.resize(offset + level.TileBytes * level.TileRows);
+
+			Uint8* dst = &level.Data[offset];
+			const Uint8* src = level.Base + row * level.TileRows * level.Pitch + col * level.TileBytes;
+
+			for (int y = 0; y < level.TileRows; y++, src += level.Pitch, dst += level.TileBytes)
+				SDL_memcpy(dst, src, level.TileBytes);
+		}
+	}
+}
@@ -0,0 +1,48 @@
+#ifndef _SNAPSHOTSTACK_H_
+#define _SNAPSHOTSTACK_H_
+
+#include <vector>
+#include <SDL.h>
+
+// Copy-on-write screen snapshots. A pushed level starts empty and saves a
+// tile the first time it is about to be overwritten, so popping only has
+// to write back the tiles that were actually damaged.
+class SnapshotStack
+{
+public:
+	SnapshotStack();
+	~SnapshotStack();
+
+	void Push(Uint8* base, int pitch, int tileBytes, int tileRows, int cols, int rows);
+	bool Pop();
+	void Clear();
+	int Depth();
+	size_t MemoryUsed();
+
+	inline bool IsActive()
+	{
+		return Top != NULL;
+	}
+
+	void Save(int col1, int row1, int col2, int row2);
+
+private:
+	struct Level
+	{
+		Uint8* Base;
+		int Pitch;
+		int TileBytes;
+		int TileRows;
+		int Cols;
+		int Rows;
+		std::vector<Uint32> Saved;
+		std::vector<int> Tiles;
+		std::vector<Uint8> Data;
+	};
+
+	std::vector<Level*> Levels;
+	int Count;
+	Level* Top;
+};
+
+#endif
@@ -0,0 +1,589 @@
+#include "Terminal.h"
+
+enum TerminalState
+{
+	STATE_GROUND = 0,
+	STATE_ESCAPE,
+	STATE_CSI,
+	STATE_CSI_IGNORE,
+	STATE_OSC,
+	STATE_COUNT
+};
+
+enum TerminalAction
+{
+	ACTION_NONE = 0,
+	ACTION_PRINT,
+	ACTION_EXECUTE,
+	ACTION_COLLECT,
+	ACTION_PARAM,
+	ACTION_ESC_DISPATCH,
+	ACTION_CSI_DISPATCH,
+	ACTION_CLEAR
+};
+
+// Each entry packs the action in the low nibble and the next state in the high one
+static byte Transitions[STATE_COUNT][256];
+static bool TransitionsBuilt = false;
+
+static void SetTransition(int state, int first, int last, int action, int next)
+{
+	for (int chr = first; chr <= last; chr++)
+		Transitions[state][chr] = (byte)(action | (next << 4));
+}
+
+static void BuildTransitions()
+{
+	SetTransition(STATE_GROUND, 0x00, 0x1f, ACTION_EXECUTE, STATE_GROUND);
+	SetTransition(STATE_GROUND, 0x20, 0xff, ACTION_PRINT, STATE_GROUND);
+	SetTransition(STATE_GROUND, 0x7f, 0x7f, ACTION_NONE, STATE_GROUND);
+
+	SetTransition(STATE_ESCAPE, 0x00, 0x1f, ACTION_EXECUTE, STATE_ESCAPE);
+	SetTransition(STATE_ESCAPE, 0x20, 0x2f, ACTION_COLLECT, STATE_ESCAPE);
+	SetTransition(STATE_ESCAPE, 0x30, 0xff, ACTION_ESC_DISPATCH, STATE_GROUND);
+	SetTransition(STATE_ESCAPE, '[', '[', ACTION_CLEAR, STATE_CSI);
+	SetTransition(STATE_ESCAPE, ']', ']', ACTION_NONE, STATE_OSC);
+	SetTransition(STATE_ESCAPE, 0x7f, 0x7f, ACTION_NONE, STATE_ESCAPE);
+
+	SetTransition(STATE_CSI, 0x00, 0x1f, ACTION_EXECUTE, STATE_CSI);
+	SetTransition(STATE_CSI, 0x20, 0x2f, ACTION_COLLECT, STATE_CSI);
+	SetTransition(STATE_CSI, 0x30, 0x39, ACTION_PARAM, STATE_CSI);
+	SetTransition(STATE_CSI, ':', ':', ACTION_NONE, STATE_CSI_IGNORE);
+	SetTransition(STATE_CSI, ';', ';', ACTION_PARAM, STATE_CSI);
+	SetTransition(STATE_CSI, 0x3c, 0x3f, ACTION_COLLECT, STATE_CSI);
+	SetTransition(STATE_CSI, 0x40, 0xff, ACTION_CSI_DISPATCH, STATE_GROUND);
+	SetTransition(STATE_CSI, 0x7f, 0x7f, ACTION_NONE, STATE_CSI);
+
+	SetTransition(STATE_CSI_IGNORE, 0x00, 0x1f, ACTION_EXECUTE, STATE_CSI_IGNORE);
+	SetTransition(STATE_CSI_IGNORE, 0x20, 0x3f, ACTION_NONE, STATE_CSI_IGNORE);
+	SetTransition(STATE_CSI_IGNORE, 0x40, 0xff, ACTION_NONE, STATE_GROUND);
+
+	SetTransition(STATE_OSC, 0x00, 0xff, ACTION_NONE, STATE_OSC);
+	SetTransition(STATE_OSC, 0x07, 0x07, ACTION_NONE, STATE_GROUND);
+
+	// Cancel and escape are honoured from every state
+	for (int state = 0; state < STATE_COUNT; state++)
+	{
+		SetTransition(state, 0x18, 0x18, ACTION_EXECUTE, STATE_GROUND);
+		SetTransition(state, 0x1a, 0x1a, ACTION_EXECUTE, STATE_GROUND);
+		SetTransition(state, 0x1b, 0x1b, ACTION_CLEAR, STATE_ESCAPE);
+	}
+
+	TransitionsBuilt = true;
+}
+
+Terminal::Terminal()
+{
+	if (!TransitionsBuilt)
+		BuildTransitions();
+
+	Reset();
+}
+
+void Terminal::Reset()
+{
+	State = STATE_GROUND;
+	ClearParams();
+
+	Col = 0;
+	Row = 0;
+	WrapPending = false;
+	SavedCol = 0;
+	SavedRow = 0;
+	ScrollTop = 0;
+	ScrollBottom = ROWS - 1;
+	CursorVisible = true;
+
+	Foreground = TERMINAL_DEFAULT_FG;
+	Background = TERMINAL_DEFAULT_BG;
+	Bold = false;
+	Reverse = false;
+
+	Screen.Fill(Blank());
+	RenderedValid = false;
+}
+
+void Terminal::Invalidate()
+{
+	RenderedValid = false;
+}
+
+int Terminal::CursorCol()
+{
+	return Col;
+}
+
+int Terminal::CursorRow()
+{
+	return Row;
+}
+
+void Terminal::Write(const char* str)
+{
+	Write(str, SDL_strlen(str));
+}
+
+void Terminal::Write(const char* data, size_t size)
+{
+	const byte* p = (const byte*)data;
+	const byte* end = p + size;
+	int state = State;
+
+	while (p < end)
+	{
+		const int chr = *p++;
+		const byte transition = Transitions[state][chr];
+		state = transition >> 4;
+
+		switch (transition & 0x0f)
+		{
+			case ACTION_PRINT:
+				Print(chr);
+				break;
+			case ACTION_EXECUTE:
+				Execute(chr);
+				break;
+			case ACTION_CLEAR:
+				ClearParams();
+				break;
+			case ACTION_COLLECT:
+				if (chr >= 0x3c && chr <= 0x3f)
+					Private = (char)chr;
+				else
+					Intermediate = (char)chr;
+				break;
+			case ACTION_PARAM:
+				if (chr == ';')
+				{
+					if (ParamCount < TERMINAL_MAX_PARAMS)
+						ParamCount++;
+					ParamStarted = false;
+				}
+				else if (ParamCount < TERMINAL_MAX_PARAMS)
+				{
+					int& param = Params[ParamCount];
+					if (param < 10000)
+						param = param * 10 + (chr - '0');
+					ParamStarted = true;
+				}
+				break;
+			case ACTION_ESC_DISPATCH:
+				EscDispatch(chr);
+				break;
+			case ACTION_CSI_DISPATCH:
+				if (ParamStarted && ParamCount < TERMINAL_MAX_PARAMS)
+					ParamCount++;
+				CsiDispatch(chr);
+				break;
+		}
+	}
+
+	State = state;
+}
+
+void Terminal::ClearParams()
+{
+	SDL_memset(Params, 0, sizeof(Params));
+	ParamCount = 0;
+	ParamStarted = false;
+	Private = 0;
+	Intermediate = 0;
+}
+
+int Terminal::Param(int index, int fallback)
+{
+	return index < ParamCount && Params[index] != 0 ? Params[index] : fallback;
+}
+
+Cell Terminal::Blank()
+{
+	return MakeCell(' ', Foreground, Background, Reverse ? CELL_ATTR_REVERSE : 0);
+}
+
+Cell Terminal::Pen(int chr)
+{
+	const int foreground = Bold && Foreground < 8 ? Foreground + 8 : Foreground;
+	return MakeCell(chr, foreground, Background, Reverse ? CELL_ATTR_REVERSE : 0);
+}
+
+void Terminal::Print(int chr)
+{
+	if (WrapPending)
+	{
+		Col = 0;
+		LineFeed();
+		WrapPending = false;
+	}
+
+	Screen.Cells[Row][Col] = Pen(chr);
+
+	if (Col == COLS - 1)
+		WrapPending = true;
+	else
+		Col++;
+}
+
+void Terminal::Execute(int chr)
+{
+	switch (chr)
+	{
+		case '\b':
+			if (Col > 0)
+				Col--;
+			WrapPending = false;
+			break;
+		case '\t':
+			Col = SDL_min((Col / TERMINAL_TAB_WIDTH + 1) * TERMINAL_TAB_WIDTH, COLS - 1);
+			WrapPending = false;
+			break;
+		case '\n':
+		case '\v':
+		case '\f':
+			LineFeed();
+			break;
+		case '\r':
+			Col = 0;
+			WrapPending = false;
+			break;
+	}
+}
+
+void Terminal::EscDispatch(int chr)
+{
+	if (Intermediate)
+		return;
+
+	switch (chr)
+	{
+		case 'D':
+			LineFeed();
+			break;
+		case 'E':
+			Col = 0;
+			LineFeed();
+			break;
+		case 'M':
+			ReverseLineFeed();
+			break;
+		case '7':
+			SavedCol = Col;
+			SavedRow = Row;
+			break;
+		case '8':
+			MoveTo(SavedCol, SavedRow);
+			break;
+		case 'c':
+			Reset();
+			break;
+	}
+}
+
+void Terminal::CsiDispatch(int chr)
+{
+	if (Intermediate)
+		return;
+
+	if (Private == '?')
+	{
+		if ((chr == 'h' || chr == 'l') && Param(0, 0) == 25)
+			CursorVisible = chr == 'h';
+		return;
+	}
+	if (Private)
+		return;
+
+	switch (chr)
+	{
+		case 'A':
+			MoveTo(Col, SDL_max(Row - Param(0, 1), Row >= ScrollTop ? ScrollTop : 0));
+			break;
+		case 'B':
+			MoveTo(Col, SDL_min(Row + Param(0, 1), Row <= ScrollBottom ? ScrollBottom : ROWS - 1));
+			break;
+		case 'C':
+			MoveTo(Col + Param(0, 1), Row);
+			break;
+		case 'D':
+			MoveTo(Col - Param(0, 1), Row);
+			break;
+		case 'E':
+			MoveTo(0, Row + Param(0, 1));
+			break;
+		case 'F':
+			MoveTo(0, Row - Param(0, 1));
+			break;
+		case 'G':
+		case '`':
+			MoveTo(Param(0, 1) - 1, Row);
+			break;
+		case 'd':
+			MoveTo(Col, Param(0, 1) - 1);
+			break;
+		case 'H':
+		case 'f':
+			MoveTo(Param(1, 1) - 1, Param(0, 1) - 1);
+			break;
+		case 'J':
+			EraseInDisplay(Param(0, 0));
+			break;
+		case 'K':
+			EraseInLine(Param(0, 0));
+			break;
+		case 'L':
+			if (Row >= ScrollTop && Row <= ScrollBottom)
+				ScrollDown(Row, ScrollBottom, Param(0, 1));
+			break;
+		case 'M':
+			if (Row >= ScrollTop && Row <= ScrollBottom)
+				ScrollUp(Row, ScrollBottom, Param(0, 1));
+			break;
+		case 'S':
+			ScrollUp(ScrollTop, ScrollBottom, Param(0, 1));
+			break;
+		case 'T':
+			ScrollDown(ScrollTop, ScrollBottom, Param(0, 1));
+			break;
+		case '@':
+		{
+			const int count = SDL_min(Param(0, 1), COLS - Col);
+			Cell* line = Screen.Cells[Row];
+			SDL_memmove(line + Col + count, line + Col, (COLS - Col - count) * sizeof(Cell));
+			ClearCells(Row, Col, Col + count - 1);
+			break;
+		}
+		case 'P':
+		{
+			const int count = SDL_min(Param(0, 1), COLS - Col);
+			Cell* line = Screen.Cells[Row];
+			SDL_memmove(line + Col, line + Col + count, (COLS - Col - count) * sizeof(Cell));
+			ClearCells(Row, COLS - count, COLS - 1);
+			break;
+		}
+		case 'X':
+			ClearCells(Row, Col, SDL_min(Col + Param(0, 1), COLS) - 1);
+			break;
+		case 'm':
+			SelectGraphicRendition();
+			break;
+		case 'r':
+		{
+			const int top = Param(0, 1) - 1;
+			const int bottom = Param(1, ROWS) - 1;
+			if (top < bottom && bottom < ROWS)
+			{
+				ScrollTop = top;
+				ScrollBottom = bottom;
+				MoveTo(0, 0);
+			}
+			break;
+		}
+		case 's':
+			SavedCol = Col;
+			SavedRow = Row;
+			break;
+		case 'u':
+			MoveTo(SavedCol, SavedRow);
+			break;
+	}
+}
+
+static int NearestPaletteColor(int r, int g, int b)
+{
+	// Map onto the 6x6x6 cube of the default palette
+	const int levels[6] = { 0x00, 0x5f, 0x87, 0xaf, 0xd7, 0xff };
+	int index[3];
+	const int channels[3] = { r, g, b };
+
+	for (int c = 0; c < 3; c++)
+	{
+		int best = 0;
+		for (int i = 1; i < 6; i++)
+			if (SDL_abs(levels[i] - channels[c]) < SDL_abs(levels[best] - channels[c]))
+				best = i;
+		index[c] = best;
+	}
+
+	return 16 + index[0] * 36 + index[1] * 6 + index[2];
+}
+
+void Terminal::SelectGraphicRendition()
+{
+	if (ParamCount == 0)
+		ParamCount = 1;
+
+	for (int i = 0; i < ParamCount; i++)
+	{
+		const int code = Params[i];
+
+		if (code == 0)
+		{
+			Foreground = TERMINAL_DEFAULT_FG;
+			Background = TERMINAL_DEFAULT_BG;
+			Bold = false;
+			Reverse = false;
+		}
+		else if (code == 1)
+			Bold = true;
+		else if (code == 22)
+			Bold = false;
+		else if (code == 7)
+			Reverse = true;
+		else if (code == 27)
+			Reverse = false;
+		else if (code >= 30 && code <= 37)
+			Foreground = code - 30;
+		else if (code == 39)
+			Foreground = TERMINAL_DEFAULT_FG;
+		else if (code >= 40 && code <= 47)
+			Background = code - 40;
+		else if (code == 49)
+			Background = TERMINAL_DEFAULT_BG;
+		else if (code >= 90 && code <= 97)
+			Foreground = code - 90 + 8;
+		else if (code >= 100 && code <= 107)
+			Background = code - 100 + 8;
+		else if (code == 38 || code == 48)
+		{
+			int color = -1;
+
+			if (i + 2 < ParamCount && Params[i + 1] == 5)
+			{
+				color = Params[i + 2] & 0xff;
+				i += 2;
+			}
+			else if (i + 4 < ParamCount && Params[i + 1] == 2)
+			{
+				color = NearestPaletteColor(Params[i + 2], Params[i + 3], Params[i + 4]);
+				i += 4;
+			}
+
+			if (color >= 0)
+			{
+				if (code == 38)
+					Foreground = color;
+				else
+					Background = color;
+			}
+		}
+	}
+}
+
+void Terminal::MoveTo(int col, int row)
+{
+	Col = SDL_max(0, SDL_min(col, COLS - 1));
+	Row = SDL_max(0, SDL_min(row, ROWS - 1));
+	WrapPending = false;
+}
+
+void Terminal::LineFeed()
+{
+	if (Row == ScrollBottom)
+		ScrollUp(ScrollTop, ScrollBottom, 1);
+	else if (Row < ROWS - 1)
+		Row++;
+
+	WrapPending = false;
+}
+
+void Terminal::ReverseLineFeed()
+{
+	if (Row == ScrollTop)
+		ScrollDown(ScrollTop, ScrollBottom, 1);
+	else if (Row > 0)
+		Row--;
+
+	WrapPending = false;
+}
+
+void Terminal::ScrollUp(int top, int bottom, int lines)
+{
+	lines = SDL_min(lines, bottom - top + 1);
+	SDL_memmove(Screen.Cells[top], Screen.Cells[top + lines], (bottom - top + 1 - lines) * sizeof(Screen.Cells[0]));
+	Screen.FillRect(0, bottom - lines + 1, COLS, lines, Blank());
+}
+
+void Terminal::ScrollDown(int top, int bottom, int lines)
+{
+	lines = SDL_min(lines, bottom - top + 1);
+	SDL_memmove(Screen.Cells[top + lines], Screen.Cells[top], (bottom - top + 1 - lines) * sizeof(Screen.Cells[0]));
+	Screen.FillRect(0, top, COLS, lines, Blank());
+}
+
+void Terminal::EraseInDisplay(int mode)
+{
+	if (mode == 0)
+	{
+		EraseInLine(0);
+		Screen.FillRect(0, Row + 1, COLS, ROWS - Row - 1, Blank());
+	}
+	else if (mode == 1)
+	{
+		EraseInLine(1);
+		Screen.FillRect(0, 0, COLS, Row, Blank());
+	}
+	else
+	{
+		Screen.Fill(Blank());
+	}
+}
+
+void Terminal::EraseInLine(int mode)
+{
+	if (mode == 0)
+		ClearCells(Row, Col, COLS - 1);
+	else if (mode == 1)
+		ClearCells(Row, 0, Col);
+	else
+		ClearCells(Row, 0, COLS - 1);
+}
+
+void Terminal::ClearCells(int row, int col1, int col2)
+{
+	Screen.FillRect(col1, row, col2 - col1 + 1, 1, Blank());
+}
+
+void Terminal::Render(Graphics& gfx)
+{
+	const Cell saved = Screen.Cells[Row][Col];
+
+	if (CursorVisible)
+		Screen.Cells[Row][Col] = saved ^ (CELL_ATTR_REVERSE << CELL_ATTR_SHIFT);
+
+	Uint32 changed[ROWS];
+
+	if (RenderedValid)
+	{
+		Screen.Diff(Rendered, changed);
+	}
+	else
+	{
+		for (int row = 0; row < ROWS; row++)
+			changed[row] = 0xffffffff >> (32 - COLS);
+	}
+
+	// Redraw each run of consecutive changed cells with one call
+	for (int row = 0; row < ROWS; row++)
+	{
+		const Uint32 mask = changed[row];
+		int col = 0;
+
+		while (col < COLS)
+		{
+			if (!(mask & (1u << col)))
+			{
+				col++;
+				continue;
+			}
+
+			const int start = col;
+			while (col < COLS && (mask & (1u << col)))
+				col++;
+
+			gfx.DrawCells(&Screen.Cells[row][start], col - start, start, row);
+		}
+	}
+
+	Rendered.CopyFrom(Screen);
+	RenderedValid = true;
+	Screen.Cells[Row][Col] = saved;
+}
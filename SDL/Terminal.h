@@ -0,0 +1,77 @@
+#ifndef _TERMINAL_H_
+#define _TERMINAL_H_
+
+#include <stddef.h>
+#include "CellGrid.h"
+
+#define TERMINAL_MAX_PARAMS 16
+#define TERMINAL_TAB_WIDTH 8
+#define TERMINAL_DEFAULT_FG 7
+#define TERMINAL_DEFAULT_BG 0
+
+// A VT100/ANSI terminal on a COLS x ROWS cell grid. Input is parsed by a
+// table-driven state machine (after the DEC ANSI parser) with no
+// allocation per byte. Render() repaints only the cells that changed
+// since the previous call, so it can be called once per frame no matter
+// how much output arrived.
+class Terminal
+{
+public:
+	CellGrid Screen;
+
+	Terminal();
+
+	void Write(const char* data, size_t size);
+	void Write(const char* str);
+	void Reset();
+	void Render(Graphics& gfx);
+	void Invalidate();
+
+	int CursorCol();
+	int CursorRow();
+
+private:
+	CellGrid Rendered;
+	bool RenderedValid;
+
+	int State;
+	int Params[TERMINAL_MAX_PARAMS];
+	int ParamCount;
+	bool ParamStarted;
+	char Private;
+	char Intermediate;
+
+	int Col;
+	int Row;
+	bool WrapPending;
+	int SavedCol;
+	int SavedRow;
+	int ScrollTop;
+	int ScrollBottom;
+	bool CursorVisible;
+
+	int Foreground;
+	int Background;
+	bool Bold;
+	bool Reverse;
+
+	Cell Blank();
+	Cell Pen(int chr);
+	void Print(int chr);
+	void Execute(int chr);
+	void EscDispatch(int chr);
+	void CsiDispatch(int chr);
+	void SelectGraphicRendition();
+	int Param(int index, int fallback);
+	void ClearParams();
+	void MoveTo(int col, int row);
+	void LineFeed();
+	void ReverseLineFeed();
+	void ScrollUp(int top, int bottom, int lines);
+	void ScrollDown(int top, int bottom, int lines);
+	void EraseInDisplay(int mode);
+	void EraseInLine(int mode);
+	void ClearCells(int row, int col1, int col2);
+};
+
+#endif
@@ -0,0 +1,283 @@
+#include <stdio.h>
+#include "TileWorld.h"
+
+TileWorld::TileWorld(size_t budgetBytes)
+{
+	SlotCount = SDL_max((int)(budgetBytes / CHUNK_BYTES), TILEWORLD_MIN_CHUNKS);
+	Storage = new Cell[(size_t)SlotCount * CHUNK_CELLS];
+	Slots.resize(SlotCount);
+
+	WorldWidth = 0;
+	WorldHeight = 0;
+	ChunksX = 0;
+	ChunksY = 0;
+	Camera[0] = 0;
+	Camera[1] = 0;
+	Used = 0;
+	Head = -1;
+	Tail = -1;
+	LoadCount = 0;
+	EvictCount = 0;
+
+	SetEmptyCell(MakeCell(' ', 0, 0));
+}
+
+TileWorld::~TileWorld()
+{
+	Close();
+	delete[] Storage;
+}
+
+bool TileWorld::Save(const char* filename, const Cell* cells, int width, int height)
+{
+	FILE* fp = fopen(filename, "wb");
+	if (!fp)
+		return false;
+
+	TileWorldHeader header;
+	header.Magic = TILEWORLD_MAGIC;
+	header.Width = width;
+	header.Height = height;
+	header.Reserved = 0;
+	bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+
+	const int chunksX = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	const int chunksY = (height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	Cell chunk[CHUNK_CELLS];
+
+	for (int cy = 0; cy < chunksY && ok; cy++)
+	{
+		for (int cx = 0; cx < chunksX && ok; cx++)
+		{
+			for (int y = 0; y < CHUNK_SIZE; y++)
+			{
+				for (int x = 0; x < CHUNK_SIZE; x++)
+				{
+					const int wx = cx * CHUNK_SIZE + x;
+					const int wy = cy * CHUNK_SIZE + y;
+					chunk[y * CHUNK_SIZE + x] = wx < width && wy < height ? cells[(size_t)wy * width + wx] : 0;
+				}
+			}
+
+			ok = fwrite(chunk, sizeof(chunk), 1, fp) == 1;
+		}
+	}
+
+	fflush(fp);
+	fclose(fp);
+	return ok;
+}
+
+bool TileWorld::Open(const char* filename)
+{
+	Close();
+
+	// Chunks are visited in camera order, not file order
+	if (!Map.Open(filename, true))
+		return false;
+
+	if (Map.Size() < sizeof(TileWorldHeader))
+	{
+		Close();
+		return false;
+	}
+
+	TileWorldHeader header;
+	SDL_memcpy(&header, Map.Data(), sizeof(header));
+
+	const int chunksX = (int)((header.Width + CHUNK_SIZE - 1) / CHUNK_SIZE);
+	const int chunksY = (int)((header.Height + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+	if (header.Magic != TILEWORLD_MAGIC || header.Width > 0x100000 || header.Height > 0x100000 ||
+		Map.Size() < sizeof(header) + (size_t)chunksX * chunksY * CHUNK_BYTES)
+	{
+		Close();
+		return false;
+	}
+
+	WorldWidth = header.Width;
+	WorldHeight = header.Height;
+	ChunksX = chunksX;
+	ChunksY = chunksY;
+	SlotOfChunk.assign((size_t)ChunksX * ChunksY, -1);
+	return true;
+}
+
+void TileWorld::Close()
+{
+	Map.Close();
+
+	WorldWidth = 0;
+	WorldHeight = 0;
+	ChunksX = 0;
+	ChunksY = 0;
+	SlotOfChunk.clear();
+	Used = 0;
+	Head = -1;
+	Tail = -1;
+}
+
+int TileWorld::Width()
+{
+	return WorldWidth;
+}
+
+int TileWorld::Height()
+{
+	return WorldHeight;
+}
+
+void TileWorld::SetEmptyCell(Cell cell)
+{
+	SDL_memset4(Empty, cell, CHUNK_CELLS);
+}
+
+Cell TileWorld::GetCell(int x, int y)
+{
+	if (x < 0 || y < 0 || x >= WorldWidth || y >= WorldHeight)
+		return Empty[0];
+
+	const Cell* chunk = GetChunk(x / CHUNK_SIZE, y / CHUNK_SIZE);
+	return chunk[(y % CHUNK_SIZE) * CHUNK_SIZE + x % CHUNK_SIZE];
+}
+
+void TileWorld::Unlink(int slot)
+{
+	Chunk& chunk = Slots[slot];
+
+	if (chunk.Prev >= 0)
+		Slots[chunk.Prev].Next = chunk.Next;
+	else
+		Head = chunk.Next;
+
+	if (chunk.Next >= 0)
+		Slots[chunk.Next].Prev = chunk.Prev;
+	else
+		Tail = chunk.Prev;
+}
+
+void TileWorld::Touch(int slot)
+{
+	if (Head == slot)
+		return;
+
+	Unlink(slot);
+
+	Slots[slot].Prev = -1;
+	Slots[slot].Next = Head;
+	if (Head >= 0)
+		Slots[Head].Prev = slot;
+	Head = slot;
+	if (Tail < 0)
+		Tail = slot;
+}
+
+const Cell* TileWorld::GetChunk(int cx, int cy)
+{
+	if (cx < 0 || cy < 0 || cx >= ChunksX || cy >= ChunksY)
+		return Empty;
+
+	const int index = cy * ChunksX + cx;
+	int slot = SlotOfChunk[index];
+
+	if (slot >= 0)
+	{
+		Touch(slot);
+		return &Storage[(size_t)slot * CHUNK_CELLS];
+	}
+
+	if (Used < SlotCount)
+	{
+		slot = Used++;
+		Slots[slot].Prev = -1;
+		Slots[slot].Next = -1;
+		if (Tail < 0)
+			Tail = slot;
+		else
+		{
+			Slots[slot].Next = Head;
+			Slots[Head].Prev = slot;
+		}
+		Head = slot;
+	}
+	else
+	{
+		slot = Tail;
+		SlotOfChunk[Slots[slot].Index] = -1;
+		Touch(slot);
+		EvictCount++;
+	}
+
+	Slots[slot].Index = index;
+	SlotOfChunk[index] = slot;
+	LoadCount++;
+
+	Cell* cells = &Storage[(size_t)slot * CHUNK_CELLS];
+	SDL_memcpy(cells, Map.Data() + sizeof(TileWorldHeader) + (size_t)index * CHUNK_BYTES, CHUNK_BYTES);
+	return cells;
+}
+
+void TileWorld::SetCamera(int x, int y)
+{
+	Camera[0] = x;
+	Camera[1] = y;
+}
+
+int TileWorld::CameraX()
+{
+	return Camera[0];
+}
+
+int TileWorld::CameraY()
+{
+	return Camera[1];
+}
+
+void TileWorld::Render(Graphics& gfx)
+{
+	TRACE_SCOPE("TileWorld::Render");
+
+	// Walk the viewport chunk by chunk and hand each visible piece to the
+	// batched cell writer
+	for (int row = 0; row < ROWS;)
+	{
+		const int wy = Camera[1] + row;
+		const int cy = wy >= 0 ? wy / CHUNK_SIZE : -1 - (-1 - wy) / CHUNK_SIZE;
+		const int oy = wy - cy * CHUNK_SIZE;
+		int h = SDL_min(CHUNK_SIZE - oy, ROWS - row);
+		if (wy < WorldHeight && wy + h > WorldHeight)
+			h = WorldHeight - wy;
+
+		for (int col = 0; col < COLS;)
+		{
+			const int wx = Camera[0] + col;
+			const int cx = wx >= 0 ? wx / CHUNK_SIZE : -1 - (-1 - wx) / CHUNK_SIZE;
+			const int ox = wx - cx * CHUNK_SIZE;
+			int w = SDL_min(CHUNK_SIZE - ox, COLS - col);
+			if (wx < WorldWidth && wx + w > WorldWidth)
+				w = WorldWidth - wx;
+
+			// Padding cells past the world edge are drawn as empty
+			const Cell* chunk = wx < WorldWidth && wy < WorldHeight ? GetChunk(cx, cy) : Empty;
+			gfx.DrawCellBlock(chunk + oy * CHUNK_SIZE + ox, CHUNK_SIZE, col, row, w, h);
+			col += w;
+		}
+
+		row += h;
+	}
+}
+
+int TileWorld::ResidentChunks()
+{
+	return Used;
+}
+
+int TileWorld::Loads()
+{
+	return LoadCount;
+}
+
+int TileWorld::Evictions()
+{
+	return EvictCount;
+}
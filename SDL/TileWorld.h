@@ -0,0 +1,85 @@
+#ifndef _TILEWORLD_H_
+#define _TILEWORLD_H_
+
+#include <vector>
+#include "Graphics.h"
+#include "MappedFile.h"
+
+#define CHUNK_SIZE 32
+#define CHUNK_CELLS (CHUNK_SIZE * CHUNK_SIZE)
+#define CHUNK_BYTES (CHUNK_CELLS * sizeof(Cell))
+#define TILEWORLD_MAGIC 0x31575458
+#define TILEWORLD_MIN_CHUNKS 4
+
+// World map file: a header followed by CHUNK_SIZE x CHUNK_SIZE chunks of
+// packed cells stored one after another in row-major chunk order, so each
+// chunk is a single contiguous read.
+struct TileWorldHeader
+{
+	Uint32 Magic;
+	Uint32 Width;
+	Uint32 Height;
+	Uint32 Reserved;
+};
+
+// A cell map larger than the screen. The map file is memory-mapped and
+// chunks are copied out on first use into a fixed pool sized by a memory
+// budget; when the pool is full the least recently used chunk is dropped.
+class TileWorld
+{
+public:
+	TileWorld(size_t budgetBytes);
+	~TileWorld();
+
+	static bool Save(const char* filename, const Cell* cells, int width, int height);
+
+	bool Open(const char* filename);
+	void Close();
+
+	int Width();
+	int Height();
+	Cell GetCell(int x, int y);
+	void SetEmptyCell(Cell cell);
+
+	void SetCamera(int x, int y);
+	int CameraX();
+	int CameraY();
+	void Render(Graphics& gfx);
+
+	int ResidentChunks();
+	int Loads();
+	int Evictions();
+
+private:
+	struct Chunk
+	{
+		int Index;
+		int Prev;
+		int Next;
+	};
+
+	MappedFile Map;
+
+	int WorldWidth;
+	int WorldHeight;
+	int ChunksX;
+	int ChunksY;
+	int Camera[2];
+	Cell Empty[CHUNK_CELLS];
+
+	int SlotCount;
+	int Used;
+	int Head;
+	int Tail;
+	Cell* Storage;
+	std::vector<Chunk> Slots;
+	std::vector<int> SlotOfChunk;
+	int LoadCount;
+	int EvictCount;
+
+	const Cell* GetChunk(int cx, int cy);
+	void Touch(int slot);
+	void Unlink(int slot);
+};
+
+#endif
@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <atomic>
+#include "Tracer.h"
+
+struct TraceBuffer
+{
+	TraceEvent Events[TRACE_BUFFER_EVENTS];
+	std::atomic<Uint32> Head;
+};
+
+static TraceBuffer* Buffers = NULL;
+static std::atomic<int> BufferCount(0);
+static std::atomic<bool> Enabled(false);
+static Uint64 BaseTicks = 0;
+
+static thread_local TraceBuffer* ThreadBuffer = NULL;
+static thread_local int ThreadBufferPool = -1;
+static std::atomic<int> PoolGeneration(0);
+
+static TraceBuffer* AcquireThreadBuffer()
+{
+	const int generation = PoolGeneration.load(std::memory_order_acquire);
+
+	// A NULL buffer for the current generation means the pool was full
+	if (ThreadBufferPool == generation)
+		return ThreadBuffer;
+
+	ThreadBuffer = NULL;
+	ThreadBufferPool = generation;
+
+	int index = BufferCount.load(std::memory_order_relaxed);
+	do
+	{
+		if (index < 0 || index >= TRACE_MAX_THREADS)
+			return NULL;
+	} while (!BufferCount.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+
+	ThreadBuffer = &Buffers[index];
+	return ThreadBuffer;
+}
+
+static void Record(const char* name, char phase)
+{
+	if (!Enabled.load(std::memory_order_relaxed))
+		return;
+
+	TraceBuffer* buffer = AcquireThreadBuffer();
+	if (!buffer)
+		return;
+
+	const Uint32 head = buffer->Head.load(std::memory_order_relaxed);
+	TraceEvent& event = buffer->Events[head % TRACE_BUFFER_EVENTS];
+	event.Name = name;
+	event.Ticks = SDL_GetPerformanceCounter();
+	event.Phase = phase;
+	buffer->Head.store(head + 1, std::memory_order_release);
+}
+
+void Tracer::Enable(bool enabled)
+{
+	if (enabled && !Buffers)
+	{
+		Buffers = new TraceBuffer[TRACE_MAX_THREADS];
+		Clear();
+	}
+
+	Enabled.store(enabled, std::memory_order_release);
+}
+
+bool Tracer::IsEnabled()
+{
+	return Enabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::Begin(const char* name)
+{
+	Record(name, 'B');
+}
+
+void Tracer::End(const char* name)
+{
+	Record(name, 'E');
+}
+
+void Tracer::Clear()
+{
+	if (!Buffers)
+		return;
+
+	for (int i = 0; i < TRACE_MAX_THREADS; i++)
+		Buffers[i].Head.store(0, std::memory_order_relaxed);
+
+	BufferCount.store(0, std::memory_order_relaxed);
+	PoolGeneration.fetch_add(1, std::memory_order_release);
+	BaseTicks = SDL_GetPerformanceCounter();
+}
+
+static void WriteJsonString(FILE* fp, const char* str)
+{
+	fputc('"', fp);
+
+	for (; *str; str++)
+	{
+		const unsigned char chr = *str;
+
+		if (chr == '"' || chr == '\\')
+			fprintf(fp, "\\%c", chr);
+		else if (chr < 0x20)
+			fprintf(fp, "\\u%04x", chr);
+		else
+			fputc(chr, fp);
+	}
+
+	fputc('"', fp);
+}
+
+bool Tracer::Export(const char* filename)
+{
+	FILE* fp = fopen(filename, "wb");
+	if (!fp)
+		return false;
+
+	const double usPerTick = 1000000.0 / (double)SDL_GetPerformanceFrequency();
+	const int threads = Buffers ? SDL_min(BufferCount.load(std::memory_order_acquire), TRACE_MAX_THREADS) : 0;
+	bool first = true;
+
+	fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+	for (int tid = 0; tid < threads; tid++)
+	{
+		TraceBuffer& buffer = Buffers[tid];
+		const Uint32 head = buffer.Head.load(std::memory_order_acquire);
+		const Uint32 count = SDL_min(head, (Uint32)TRACE_BUFFER_EVENTS);
+		int depth = 0;
+
+		for (Uint32 i = head - count; i != head; i++)
+		{
+			const TraceEvent event = buffer.Events[i % TRACE_BUFFER_EVENTS];
+
+			// Skip slots the writer overwrote while we were reading
+			const Uint32 now = buffer.Head.load(std::memory_order_acquire);
+			if (now - i >= TRACE_BUFFER_EVENTS)
+				continue;
+
+			// Ends whose begin fell out of the ring would confuse the viewer
+			if (event.Phase == 'E' && depth == 0)
+				continue;
+			depth += event.Phase == 'B' ? 1 : -1;
+
+			fprintf(fp, "%s\n{\"name\":", first ? "" : ",");
+			WriteJsonString(fp, event.Name);
+			fprintf(fp, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+				event.Phase, (double)(Sint64)(event.Ticks - BaseTicks) * usPerTick, tid + 1);
+			first = false;
+		}
+	}
+
+	fprintf(fp, "\n]}\n");
+	fclose(fp);
+	return true;
+}
+
+TraceScope::TraceScope(const char* name)
+{
+	Name = name;
+	Tracer::Begin(name);
+}
+
+TraceScope::~TraceScope()
+{
+	Tracer::End(Name);
+}
@@ -0,0 +1,50 @@
+#ifndef _TRACER_H_
+#define _TRACER_H_
+
+#include <SDL.h>
+
+#define TRACE_BUFFER_EVENTS 65536
+#define TRACE_MAX_THREADS 8
+
+struct TraceEvent
+{
+	const char* Name;
+	Uint64 Ticks;
+	char Phase;
+};
+
+// Records begin/end events into per-thread ring buffers and exports them
+// as Chrome trace JSON (chrome://tracing, Perfetto). Event names must be
+// string literals or otherwise outlive the export.
+class Tracer
+{
+public:
+	static void Enable(bool enabled);
+	static bool IsEnabled();
+	static void Begin(const char* name);
+	static void End(const char* name);
+	static bool Export(const char* filename);
+	static void Clear();
+};
+
+class TraceScope
+{
+public:
+	TraceScope(const char* name);
+	~TraceScope();
+
+private:
+	const char* Name;
+};
+
+#ifdef GRAPHICS_TRACE
+#define TRACE_BEGIN(name) Tracer::Begin(name)
+#define TRACE_END(name) Tracer::End(name)
+#define TRACE_SCOPE(name) TraceScope _trace_scope(name)
+#else
+#define TRACE_BEGIN(name)
+#define TRACE_END(name)
+#define TRACE_SCOPE(name)
+#endif
+
+#endif
@@ -0,0 +1,344 @@
+// BenchGate: runs a benchmark program several times, summarizes each metric
+// and compares it against a baseline file.
+//
+// The benchmark prints one line per measurement on stdout:
+//
+//     BENCH <metric> <value>
+//
+// Values are costs (time, cycles, bytes), so lower is better. Other output
+// is ignored. The baseline is a flat JSON object of metric medians:
+//
+//     { "DrawCellBlock_us": 93.7, "Scroll_us": 8.2 }
+//
+// Usage: BenchGate [options] -- <benchmark command...>
+//     --baseline FILE    baseline JSON (default bench_baseline.json)
+//     --runs N           measured runs (default 10)
+//     --warmup N         discarded runs before measuring (default 2)
+//     --threshold PCT    allowed slowdown in percent (default 5)
+//     --cpu N            pin to this CPU before running (default 0, -1 = off)
+//     --update           write the measured medians as the new baseline
+//     --allow-missing    do not fail on baseline metrics the run did not print
+//
+// No baseline ships with the tree; create one on the benchmark machine
+// with --update. Exit status is 0 when every baseline metric was measured
+// and none regressed, 1 on a regression or missing metric, 2 on error.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#define popen _popen
+#define pclose _pclose
+#else
+#include <sched.h>
+#endif
+
+#define LINE_MAXLEN 4096
+#define OUTLIER_MADS 3.5
+#define CONFIDENCE_Z 1.96
+
+typedef std::map<std::string, std::vector<double>> Samples;
+typedef std::map<std::string, double> Baseline;
+
+struct Summary
+{
+	double Median;
+	double Low;
+	double High;
+	int Kept;
+	int Rejected;
+};
+
+static bool PinToCpu(int cpu)
+{
+	// The benchmark is started by this process and inherits the affinity
+#ifdef _WIN32
+	return SetProcessAffinityMask(GetCurrentProcess(), (DWORD_PTR)1 << cpu) != 0;
+#elif defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+	return false;
+#endif
+}
+
+static bool RunOnce(const std::string& command, Samples* samples)
+{
+	FILE* fp = popen(command.c_str(), "r");
+	if (!fp)
+		return false;
+
+	char line[LINE_MAXLEN];
+	char name[LINE_MAXLEN];
+	double value;
+
+	while (fgets(line, sizeof(line), fp))
+	{
+		if (samples && sscanf(line, "BENCH %4095s %lf", name, &value) == 2)
+			(*samples)[name].push_back(value);
+	}
+
+	return pclose(fp) == 0;
+}
+
+static double Median(std::vector<double> values)
+{
+	std::sort(values.begin(), values.end());
+	const size_t n = values.size();
+	return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+static Summary Summarize(const std::vector<double>& values)
+{
+	// Reject samples far from the median in units of the median absolute
+	// deviation, which a handful of outliers cannot inflate
+	const double median = Median(values);
+	std::vector<double> deviations;
+	for (size_t i = 0; i < values.size(); i++)
+		deviations.push_back(fabs(values[i] - median));
+	const double mad = Median(deviations) * 1.4826;
+
+	std::vector<double> kept;
+	for (size_t i = 0; i < values.size(); i++)
+		if (mad == 0 || fabs(values[i] - median) <= OUTLIER_MADS * mad)
+			kept.push_back(values[i]);
+
+	std::sort(kept.begin(), kept.end());
+
+	// Distribution-free interval for the median from order statistics
+	const int n = (int)kept.size();
+	const double spread = CONFIDENCE_Z * sqrt((double)n) / 2;
+	const int low = std::max(0, (int)floor(n / 2.0 - spread));
+	const int high = std::min(n - 1, (int)ceil(n / 2.0 + spread) - 1);
+
+	Summary summary;
+	summary.Median = Median(kept);
+	summary.Low = kept[low];
+	summary.High = kept[std::max(low, high)];
+	summary.Kept = n;
+	summary.Rejected = (int)values.size() - n;
+	return summary;
+}
+
+static bool LoadBaseline(const char* filename, Baseline& baseline)
+{
+	FILE* fp = fopen(filename, "rb");
+	if (!fp)
+		return false;
+
+	std::string text;
+	char buffer[LINE_MAXLEN];
+	size_t count;
+	while ((count = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+		text.append(buffer, count);
+	fclose(fp);
+
+	// Only flat objects of "name": number pairs are accepted
+	size_t pos = text.find('{');
+	if (pos == std::string::npos)
+		return false;
+
+	while (true)
+	{
+		const size_t open = text.find('"', pos + 1);
+		if (open == std::string::npos)
+			break;
+		const size_t close = text.find('"', open + 1);
+		const size_t colon = close == std::string::npos ? close : text.find(':', close + 1);
+		if (colon == std::string::npos)
+			return false;
+
+		char* end;
+		const double value = strtod(text.c_str() + colon + 1, &end);
+		if (end == text.c_str() + colon + 1)
+			return false;
+
+		baseline[text.substr(open + 1, close - open - 1)] = value;
+		pos = end - text.c_str();
+	}
+
+	return true;
+}
+
+static bool SaveBaseline(const char* filename, const std::map<std::string, Summary>& results)
+{
+	FILE* fp = fopen(filename, "wb");
+	if (!fp)
+		return false;
+
+	fprintf(fp, "{\n");
+	size_t i = 0;
+	for (std::map<std::string, Summary>::const_iterator it = results.begin(); it != results.end(); ++it, ++i)
+		fprintf(fp, "\t\"%s\": %.6g%s\n", it->first.c_str(), it->second.Median, i + 1 < results.size() ? "," : "");
+	fprintf(fp, "}\n");
+
+	fflush(fp);
+	fclose(fp);
+	return true;
+}
+
+static void Usage()
+{
+	fprintf(stderr, "Usage: BenchGate [--baseline FILE] [--runs N] [--warmup N] [--threshold PCT] [--cpu N] [--update] [--allow-missing] -- command...\n");
+}
+
+int main(int argc, char** argv)
+{
+	const char* baselineFile = "bench_baseline.json";
+	int runs = 10;
+	int warmup = 2;
+	double threshold = 5;
+	int cpu = 0;
+	bool update = false;
+	bool allowMissing = false;
+	std::string command;
+
+	int i = 1;
+	for (; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (!strcmp(arg, "--"))
+		{
+			i++;
+			break;
+		}
+		else if (!strcmp(arg, "--baseline") && hasValue)
+			baselineFile = argv[++i];
+		else if (!strcmp(arg, "--runs") && hasValue)
+			runs = atoi(argv[++i]);
+		else if (!strcmp(arg, "--warmup") && hasValue)
+			warmup = atoi(argv[++i]);
+		else if (!strcmp(arg, "--threshold") && hasValue)
+			threshold = atof(argv[++i]);
+		else if (!strcmp(arg, "--cpu") && hasValue)
+			cpu = atoi(argv[++i]);
+		else if (!strcmp(arg, "--update"))
+			update = true;
+		else if (!strcmp(arg, "--allow-missing"))
+			allowMissing = true;
+		else
+		{
+			Usage();
+			return 2;
+		}
+	}
+
+	for (; i < argc; i++)
+	{
+		if (!command.empty())
+			command += ' ';
+		command += argv[i];
+	}
+
+	if (command.empty() || runs < 1 || warmup < 0)
+	{
+		Usage();
+		return 2;
+	}
+
+	if (cpu >= 0 && !PinToCpu(cpu))
+		fprintf(stderr, "warning: could not pin to CPU %d\n", cpu);
+
+	for (int run = 0; run < warmup; run++)
+	{
+		if (!RunOnce(command, NULL))
+		{
+			fprintf(stderr, "error: benchmark failed during warm-up\n");
+			return 2;
+		}
+	}
+
+	Samples samples;
+	for (int run = 0; run < runs; run++)
+	{
+		if (!RunOnce(command, &samples))
+		{
+			fprintf(stderr, "error: benchmark failed on run %d\n", run + 1);
+			return 2;
+		}
+	}
+
+	if (samples.empty())
+	{
+		fprintf(stderr, "error: benchmark printed no BENCH lines\n");
+		return 2;
+	}
+
+	std::map<std::string, Summary> results;
+	for (Samples::const_iterator it = samples.begin(); it != samples.end(); ++it)
+		results[it->first] = Summarize(it->second);
+
+	if (update)
+	{
+		if (!SaveBaseline(baselineFile, results))
+		{
+			fprintf(stderr, "error: cannot write %s\n", baselineFile);
+			return 2;
+		}
+		printf("baseline written to %s (%d metrics)\n", baselineFile, (int)results.size());
+		return 0;
+	}
+
+	Baseline baseline;
+	if (!LoadBaseline(baselineFile, baseline))
+	{
+		fprintf(stderr, "error: cannot read baseline %s (create it with --update)\n", baselineFile);
+		return 2;
+	}
+
+	int regressions = 0;
+	printf("%-32s %12s %12s %25s %9s  %s\n", "metric", "baseline", "median", "95% interval", "change", "status");
+
+	for (std::map<std::string, Summary>::const_iterator it = results.begin(); it != results.end(); ++it)
+	{
+		const Summary& s = it->second;
+		char interval[64];
+		snprintf(interval, sizeof(interval), "[%.4g, %.4g]", s.Low, s.High);
+
+		Baseline::const_iterator base = baseline.find(it->first);
+		if (base == baseline.end())
+		{
+			printf("%-32s %12s %12.4g %25s %9s  new\n", it->first.c_str(), "-", s.Median, interval, "-");
+			continue;
+		}
+
+		// A metric regresses only if the median is over the threshold and
+		// the whole interval sits above the baseline, so noise alone passes
+		const double change = base->second != 0 ? (s.Median / base->second - 1) * 100 : 0;
+		const bool regressed = change > threshold && s.Low > base->second;
+		const char* status = regressed ? "REGRESSED" : change < -threshold ? "improved" : "ok";
+
+		if (regressed)
+			regressions++;
+
+		printf("%-32s %12.4g %12.4g %25s %+8.1f%%  %s", it->first.c_str(), base->second, s.Median, interval, change, status);
+		if (s.Rejected)
+			printf(" (%d outliers)", s.Rejected);
+		printf("\n");
+	}
+
+	// A renamed or crashed sub-benchmark must not pass by printing nothing
+	int missing = 0;
+	for (Baseline::const_iterator it = baseline.begin(); it != baseline.end(); ++it)
+	{
+		if (results.find(it->first) == results.end())
+		{
+			printf("%-32s %12.4g %12s %25s %9s  %s\n", it->first.c_str(), it->second, "-", "-", "-", allowMissing ? "missing" : "MISSING");
+			missing++;
+		}
+	}
+
+	printf("\n%d metric(s), %d regression(s), %d missing, threshold %.1f%%\n", (int)results.size(), regressions, missing, threshold);
+	return regressions || (missing && !allowMissing) ? 1 : 0;
+}
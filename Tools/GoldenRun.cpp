@@ -0,0 +1,56 @@
+// GoldenRun: renders the built-in golden scenes on a headless Graphics and
+// compares each frame against the hashes recorded in <dir>/golden.txt.
+// Mismatching scenes leave <scene>.actual.bmp and <scene>.diff.bmp next to
+// the reference bitmaps.
+//
+// Usage: GoldenRun [options]
+//     --dir DIR     golden directory (default SDL/golden)
+//     --record      rewrite the hashes and reference bitmaps
+//
+// Exit status is 0 when every scene matches, 1 on a mismatch, 2 on error.
+
+#include <stdio.h>
+#include <string.h>
+#include "GoldenScenes.h"
+
+static void Usage()
+{
+	fprintf(stderr, "Usage: GoldenRun [--dir DIR] [--record]\n");
+}
+
+int main(int argc, char** argv)
+{
+	const char* directory = "SDL/" GOLDEN_DIRECTORY;
+	bool record = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+
+		if (!strcmp(arg, "--dir") && i + 1 < argc)
+			directory = argv[++i];
+		else if (!strcmp(arg, "--record"))
+			record = true;
+		else
+		{
+			Usage();
+			return 2;
+		}
+	}
+
+	Graphics gfx(0, false, true);
+	const int failures = RunGoldenScenes(gfx, directory, record);
+
+	if (failures < 0)
+	{
+		fprintf(stderr, "error: cannot write %s/%s\n", directory, GOLDEN_HASH_FILE);
+		return 2;
+	}
+
+	if (record)
+		printf("golden hashes written to %s/%s\n", directory, GOLDEN_HASH_FILE);
+	else
+		printf("%d scene(s) failed\n", failures);
+
+	return failures ? 1 : 0;
+}